@@ -0,0 +1,78 @@
+#include "command_registry.h"
+#include <string.h>
+
+CommandRegistry::CommandRegistry() : count(0) {
+}
+
+bool CommandRegistry::add(uint32_t id, CommandHandler handler, void* target, uint8_t sources) {
+    if (count >= MAX_COMMANDS || handler == NULL || find(id) != NULL) return false;
+    
+    // Insertion triée pour la recherche dichotomique
+    uint8_t pos = count;
+    while (pos > 0 && entries[pos - 1].id > id) {
+        entries[pos] = entries[pos - 1];
+        pos--;
+    }
+    
+    entries[pos].id = id;
+    entries[pos].handler = handler;
+    entries[pos].target = target;
+    entries[pos].sources = sources;
+    count++;
+    return true;
+}
+
+const CommandRegistry::CommandEntry* CommandRegistry::find(uint32_t id) const {
+    int low = 0;
+    int high = count - 1;
+    
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (entries[mid].id == id) return &entries[mid];
+        if (entries[mid].id < id) low = mid + 1;
+        else high = mid - 1;
+    }
+    return NULL;
+}
+
+uint32_t CommandRegistry::hash(const char* name, size_t length) {
+    uint32_t value = 2166136261UL;
+    for (size_t i = 0; i < length; i++) {
+        value = (value ^ (uint8_t)name[i]) * 16777619UL;
+    }
+    return value;
+}
+
+CommandResult CommandRegistry::dispatch(uint32_t id, const char* args, CommandSource source) {
+    const CommandEntry* entry = find(id);
+    if (entry == NULL || !(entry->sources & source)) return CMD_UNKNOWN;
+    
+    CommandRequest request = { id, args ? args : "", source };
+    return entry->handler(entry->target, request);
+}
+
+CommandResult CommandRegistry::dispatch(char* line, CommandSource source) {
+    // Espaces en tête
+    while (*line == ' ' || *line == '\t') line++;
+    
+    // Nom de la commande, mis en minuscules sur place
+    char* name = line;
+    while (*line && *line != ' ' && *line != '\t' && *line != '\r' && *line != '\n') {
+        if (*line >= 'A' && *line <= 'Z') *line += 'a' - 'A';
+        line++;
+    }
+    size_t nameLength = line - name;
+    if (nameLength == 0) return CMD_INVALID;
+    
+    // Arguments : reste de la ligne, sans espaces ni fin de ligne
+    char* args = line;
+    if (*args) {
+        *args++ = '\0';
+        while (*args == ' ' || *args == '\t') args++;
+        char* end = args + strlen(args);
+        while (end > args && (end[-1] == ' ' || end[-1] == '\r' || end[-1] == '\n' || end[-1] == '\t')) end--;
+        *end = '\0';
+    }
+    
+    return dispatch(hash(name, nameLength), args, source);
+}
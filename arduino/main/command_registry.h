@@ -0,0 +1,70 @@
+#ifndef COMMAND_REGISTRY_H
+#define COMMAND_REGISTRY_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#endif
+
+const uint8_t MAX_COMMANDS = 40;
+const size_t COMMAND_MAX_LENGTH = 64;
+
+// Identifiant de commande : FNV-1a 32 bits, calculé à la compilation pour les constantes
+constexpr uint32_t commandId(const char* name, uint32_t hash = 2166136261UL) {
+    return *name ? commandId(name + 1, (uint32_t)((hash ^ (uint8_t)*name) * 16777619UL)) : hash;
+}
+
+enum CommandSource {
+    CMD_SOURCE_SERIAL = 0x01,
+    CMD_SOURCE_WIFI = 0x02
+};
+
+const uint8_t CMD_SOURCE_ANY = CMD_SOURCE_SERIAL | CMD_SOURCE_WIFI;
+
+enum CommandResult {
+    CMD_OK,
+    CMD_BLOCKED,
+    CMD_UNKNOWN,
+    CMD_INVALID,
+    CMD_RESEND,   // Bien formée mais refusée : à renvoyer depuis la position indiquée par l'état
+    CMD_PENDING   // Acceptée, issue connue plus tard (lisible dans l'état du robot)
+};
+
+struct CommandRequest {
+    uint32_t id;
+    const char* args;   // Arguments après le nom (chaîne vide si aucun)
+    CommandSource source;
+};
+
+typedef CommandResult (*CommandHandler)(void* target, const CommandRequest& request);
+
+// Registre unique des commandes série et WiFi : table triée par identifiant,
+// recherche dichotomique, aucune allocation par commande
+class CommandRegistry {
+private:
+    struct CommandEntry {
+        uint32_t id;
+        CommandHandler handler;
+        void* target;
+        uint8_t sources;
+    };
+    
+    CommandEntry entries[MAX_COMMANDS];
+    uint8_t count;
+    
+    const CommandEntry* find(uint32_t id) const;
+    
+public:
+    CommandRegistry();
+    bool add(uint32_t id, CommandHandler handler, void* target, uint8_t sources = CMD_SOURCE_SERIAL);
+    
+    // Découpe la ligne sur place (nom en minuscules, arguments intacts) puis exécute
+    CommandResult dispatch(char* line, CommandSource source);
+    CommandResult dispatch(uint32_t id, const char* args, CommandSource source);
+    
+    static uint32_t hash(const char* name, size_t length);
+};
+
+#endif
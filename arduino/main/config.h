@@ -10,15 +10,18 @@
 #define AIN 7
 #define BIN 8
 #define STBY 3
+#define MPU_INT_PIN 2
 
 // ===== DISTANCE SENSOR CONFIGURATION =====
 const unsigned long MEASURE_INTERVAL = 300;
 const float MAX_VALID_DISTANCE = 400.0;
 const float INVALID_DISTANCE = 999.0;
 const unsigned long PULSE_TIMEOUT = 25000;
+const bool ULTRASONIC_CAPTURE_MODE = true;  // Fronts d'écho horodatés par interruption (sinon pulseIn)
 
 // ===== OBSTACLE DETECTION =====
 const float OBSTACLE_DISTANCE_CM = 30.0;
+const unsigned long FRONT_READING_MAX_AGE = 150;   // Mesure frontale trop ancienne pour rouler en avant (ms)
 
 // ===== SERVO CONFIGURATION =====
 const int SERVO_CENTER = 90;
@@ -27,38 +30,128 @@ const int SERVO_RIGHT = 30;
 const int SERVO_MIN = 0;
 const int SERVO_MAX = 180;
 const unsigned long SERVO_DELAY = 1000;
+const unsigned long SERVO_SETTLE_BASE_MS = 40;        // Temps mort avant mesure
+const unsigned long SERVO_SETTLE_PER_DEGREE_MS = 3;   // Temps de stabilisation par degré parcouru
+const unsigned long SCAN_RESULT_MAX_AGE = 1000;       // Validité d'une mesure latérale (ms)
 
 // ===== MOTOR CONFIGURATION =====
 const int MOTOR_SPEED_NORMAL = 200;
 const int MOTOR_SPEED_TURN = 220;
 const int MOTOR_SPEED_CURVE = 140;
 const unsigned long ROTATION_90_DURATION = 200;
+const float MOTOR_PWM_TO_MPS = 0.0025;   // Vitesse au sol par unité de PWM (à étalonner : 200 ≈ 0,5 m/s)
+const int MOTOR_MAX_PWM = 255;
 
 // ===== WIFI CONFIGURATION =====
 #define WIFI_SSID "MMA"
 #define WIFI_PASSWORD "12345678"
 const int WIFI_PORT = 80;
-const unsigned long CLIENT_TIMEOUT = 100;
+const uint8_t MAX_HTTP_CONNECTIONS = 4;             // Sockets gardés ouverts simultanément
+const unsigned long HTTP_REQUEST_TIMEOUT = 1000;    // Requête incomplète (ms)
+const unsigned long HTTP_KEEPALIVE_TIMEOUT = 5000;  // Connexion inactive (ms)
+const uint8_t HTTP_BYTES_PER_TICK = 128;            // Octets lus au plus par socket et par passage
+const size_t HTTP_RESPONSE_BUFFER_SIZE = 1024;       // En-têtes + corps (/metrics, /status, événements /stream)
+const unsigned int STREAM_DEFAULT_RATE_HZ = 10;     // Cadence par défaut de /stream
+const unsigned int STREAM_MAX_RATE_HZ = 50;
+const uint16_t UDP_CONTROL_PORT = 4210;             // Canal binaire de pilotage manuel
+const uint8_t UDP_PACKETS_PER_TICK = 4;
+const size_t REQUEST_LINE_MAX = 128;
 
 // ===== GPS CONFIGURATION =====
-const int GPS_RX_PIN = A2;
-const int GPS_TX_PIN = A1;
+// UART matériel (D0 = RX, D1 = TX) : réception par interruption dans le tampon du cœur,
+// sans masquer les interruptions à chaque octet comme SoftwareSerial
+#define GPS_SERIAL Serial1
 const unsigned long GPS_BAUD = 9600;
+const size_t GPS_UART_BUFFER_SIZE = 512;    // Tampon de réception du cœur UNO R4 (SERIAL_BUFFER_SIZE)
+const uint8_t GPS_BYTES_PER_TICK = 128;     // Au plus ~77 octets par période de 20 ms à 38400 bauds
+const bool GPS_UBX_MODE = true;             // NAV-PVT binaire (u-blox), repli NMEA sinon
+const unsigned long GPS_UBX_BAUD = 38400;   // 10 trames NAV-PVT de 100 octets/s dépassent 9600 bauds
+const uint16_t GPS_UBX_RATE_MS = 100;       // Période de navigation du récepteur (10 Hz)
+const unsigned long GPS_UBX_DETECT_TIMEOUT = 3000;  // Sans trame UBX valide : repli NMEA (ms)
+const float GPS_NMEA_UERE = 5.0;            // Erreur équivalente pour estimer hAcc depuis le HDOP (m)
+
+// ===== I2C CONFIGURATION =====
+const uint32_t I2C_CLOCK_HZ = 400000;            // Mode rapide
+const uint8_t I2C_TRANSACTIONS_PER_TICK = 1;     // Transactions exécutées par passage de la tâche I2C
 
 // ===== MPU-6500 CONFIGURATION =====
 const int MPU6500_ADDR = 0x68;
-const int GYRO_SAMPLES_CALIBRATION = 500;
-const unsigned long MIN_GYRO_INTERVAL = 10; 
+const int GYRO_SAMPLES_CALIBRATION = 500;   // Calibration manuelle (commande "calibrate")
+const uint16_t MPU_ZUPT_WINDOW = 100;        // Fenêtre d'immobilité (échantillons, 0,5 s à 200 Hz)
+const float MPU_ZUPT_MAX_STDDEV = 0.3;       // Bruit maximal d'une fenêtre immobile (°/s)
+const float MPU_ZUPT_MAX_STEP = 2.0;         // Écart maximal au biais courant (°/s)
+const float MPU_BIAS_FORGETTING = 0.99;      // Oubli par fenêtre retenue (~50 s d'immobilité en mémoire)
+const float MPU_BIAS_REFERENCE_TEMP = 25.0;  // Température de référence du modèle de biais (°C)
+const float MPU_BIAS_MIN_TEMP_SPREAD = 1.5;  // Écart-type de température requis pour estimer la pente (°C)
+const int MPU_BIAS_EEPROM_ADDR = 0;          // Modèle de biais (16 octets) en mémoire non volatile
+const unsigned long MPU_BIAS_SAVE_INTERVAL = 600000;  // Écritures espacées (usure de la flash, ms)
+const float MPU_BIAS_SAVE_MIN_CHANGE = 0.02; // Variation d'offset justifiant une sauvegarde (°/s)
+const uint16_t MPU_SAMPLE_RATE_HZ = 200;   // Cadence d'échantillonnage interne (FIFO)
+const uint8_t MPU_DLPF_CFG = 3;            // Filtre passe-bas numérique : 41 Hz (base 1 kHz)
+const uint8_t MPU_FIFO_BURST_SAMPLES = 8;  // Échantillons lus au plus par transaction (4 octets, tampon Wire de 32)
+const bool MPU_INTERRUPT_MODE = true;      // Échantillons horodatés par la broche INT (sinon FIFO seule)
+const unsigned long MPU_INT_TIMEOUT = 100; // INT muette (non câblée) : retour à la lecture FIFO seule (ms)
 
 
 const double ARRIVAL_DISTANCE = 3.0;     
-const double ANGLE_TOLERANCE = 6.0;       
 const int FORWARD_SPEED = 150;            
 const int MIN_TURN_SPEED = 100;           
 const int MAX_TURN_SPEED = 180;           
 
+// ===== HEADING CONTROLLER CONFIGURATION =====
+const float HEADING_KP = 2.0;              // PWM de différentiel par degré d'erreur
+const float HEADING_KI = 0.5;              // PWM par degré·seconde (écart entre moteurs)
+const float HEADING_KD = 0.25;             // PWM par °/s mesuré au gyroscope (amortissement)
+const float HEADING_INTEGRAL_ZONE = 15.0;  // Intégration seulement sous cette erreur (°)
+const float HEADING_INTEGRAL_LIMIT = 40.0; // Contribution maximale de l'intégrale (PWM)
+const float HEADING_MAX_DIFF = 180.0;      // Différentiel maximal entre les roues (PWM)
+const float HEADING_SLEW_RATE = 600.0;     // Variation maximale du différentiel (PWM/s)
+
+// ===== MISSION CONFIGURATION =====
+const uint8_t MISSION_MAX_WAYPOINTS = 48;
+const float MISSION_DEFAULT_SPEED = MOTOR_SPEED_NORMAL * MOTOR_PWM_TO_MPS;   // m/s
+const float MISSION_DEFAULT_RADIUS = ARRIVAL_DISTANCE;                      // m
+const float PURSUIT_MIN_LOOKAHEAD = 3.0;   // Distance de visée minimale (m)
+const float PURSUIT_LOOKAHEAD_TIME = 4.0;  // Visée à vitesse × durée (s)
+const int MISSION_EEPROM_ADDR = 64;             // Après le modèle de biais gyroscope
+const uint16_t MISSION_EEPROM_CAPACITY = 1024;  // Octets de données (≈ 6 par tronçon de 100 m)
+const uint8_t MISSION_CHUNK_MAX = 16;           // Octets par morceau envoyé (ligne de commande de 64)
+
+// ===== POSE ESTIMATOR (EKF) CONFIGURATION =====
+const float EKF_INITIAL_HEADING_SIGMA = 180.0;  // Cap initial inconnu (°)
+const float EKF_SPEED_TIME_CONSTANT = 0.3;      // Réponse de la vitesse à la consigne (s)
+const float EKF_POSITION_NOISE = 0.05;          // Glissement latéral (m/√s)
+const float EKF_GYRO_NOISE = 0.5;               // Dérive du cap intégré (°/√s)
+const float EKF_ACCEL_NOISE = 0.5;              // Écart à la consigne de vitesse (m/s/√s)
+const float EKF_MIN_GPS_ACCURACY = 1.0;         // Plancher de la précision GPS annoncée (m)
+const float EKF_GPS_SPEED_NOISE = 0.2;          // m/s
+const float EKF_GPS_COURSE_NOISE = 5.0;         // °
+const float EKF_COURSE_MIN_SPEED = 0.3;         // Route GPS ignorée en dessous (m/s)
+const float EKF_STILL_MAX_SPEED = 0.3;          // Consigne nulle : vitesse GPS au-delà ignorée (m/s)
+
 
 const unsigned long SERIAL_BAUD = 115200; 
+const uint8_t SERIAL_BYTES_PER_TICK = 64;  // Octets lus au plus par passage de la tâche série
+
+// ===== LOG CONFIGURATION =====
+// 0: aucun (production), 1: erreurs, 2: avertissements, 3: infos, 4: debug
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 3
+#endif
+const size_t LOG_BUFFER_SIZE = 1024;
+
+// ===== SCHEDULER CONFIGURATION (périodes en µs) =====
+const unsigned long TASK_PERIOD_I2C = 1000;           // 1 kHz (file de transactions I2C)
+const unsigned long TASK_PERIOD_GYRO = 10000;         // 100 Hz
+const unsigned long TASK_PERIOD_MOTOR = 10000;        // 100 Hz (timeouts de rotation)
+const unsigned long TASK_PERIOD_GPS = 20000;          // 50 Hz
+const unsigned long TASK_PERIOD_SERVO = 10000;        // 100 Hz
+const unsigned long TASK_PERIOD_ULTRASONIC = 50000;   // 20 Hz
+const unsigned long TASK_PERIOD_NAVIGATION = 20000;   // 50 Hz (pose estimée, pas seulement GPS)
+const unsigned long TASK_PERIOD_WIFI = 5000;          // 200 Hz
+const unsigned long TASK_PERIOD_UDP = 2000;           // 500 Hz
+const unsigned long TASK_PERIOD_SERIAL = 20000;       // 50 Hz
+const unsigned long TASK_PERIOD_LOG = 5000;           // 200 Hz
 
 
 
@@ -1,24 +1,37 @@
 #include "distance_sensor.h"
+#include "logger.h"
+
+DistanceSensor* DistanceSensor::captureInstance = NULL;
 
 DistanceSensor::DistanceSensor(int trig, int echo) 
-    : trigPin(trig), echoPin(echo), lastValidDistance(INVALID_DISTANCE), lastMeasure(0) {
+    : trigPin(trig), echoPin(echo), lastValidDistance(INVALID_DISTANCE), lastMeasure(0),
+      captureMode(false), measurementPending(false), triggerTime(0),
+      echoState(ECHO_IDLE), echoStart(0), echoEnd(0) {
 }
 
 void DistanceSensor::init() {
     pinMode(trigPin, OUTPUT);
     pinMode(echoPin, INPUT);
-    Serial.println("✅ Capteur distance initialisé");
+    
+    if (ULTRASONIC_CAPTURE_MODE) {
+        captureInstance = this;
+        attachInterrupt(digitalPinToInterrupt(echoPin), echoISR, CHANGE);
+        captureMode = true;
+    }
+    
+    Serial.print("✅ Capteur distance initialisé");
+    Serial.println(captureMode ? " (capture par interruption)" : " (pulseIn)");
 }
 
-float DistanceSensor::measureDistance() {
+void DistanceSensor::sendTrigger() {
     digitalWrite(trigPin, LOW);
     delayMicroseconds(2);
     digitalWrite(trigPin, HIGH);
     delayMicroseconds(10);
     digitalWrite(trigPin, LOW);
+}
 
-    long duration = pulseIn(echoPin, HIGH, PULSE_TIMEOUT);
-    
+float DistanceSensor::durationToDistance(unsigned long duration) {
     if (duration > 0) {
         float distance = (duration * 0.034) / 2.0;
         if (distance <= MAX_VALID_DISTANCE) {
@@ -28,21 +41,103 @@ float DistanceSensor::measureDistance() {
     return INVALID_DISTANCE;
 }
 
+// Mesure bloquante (pulseIn), conservée pour les diagnostics
+float DistanceSensor::measureDistance() {
+    if (captureMode) detachInterrupt(digitalPinToInterrupt(echoPin));
+    
+    sendTrigger();
+    long duration = pulseIn(echoPin, HIGH, PULSE_TIMEOUT);
+    
+    if (captureMode) attachInterrupt(digitalPinToInterrupt(echoPin), echoISR, CHANGE);
+    
+    return durationToDistance(duration > 0 ? duration : 0);
+}
+
+// === MESURE NON BLOQUANTE ===
+
+void DistanceSensor::startMeasurement() {
+    measurementPending = true;
+    if (!captureMode) return;  // La mesure sera faite (bloquante) au relevé
+    
+    echoState = ECHO_WAITING;
+    sendTrigger();
+    triggerTime = micros();
+}
+
+bool DistanceSensor::pollMeasurement(float& distance) {
+    if (!measurementPending) return false;
+    
+    if (!captureMode) {
+        measurementPending = false;
+        distance = measureDistance();
+        return true;
+    }
+    
+    if (echoState == ECHO_DONE) {
+        noInterrupts();
+        unsigned long duration = echoEnd - echoStart;
+        interrupts();
+        
+        measurementPending = false;
+        echoState = ECHO_IDLE;
+        distance = durationToDistance(duration);
+        return true;
+    }
+    
+    // Pas d'écho dans le délai : aucune cible à portée
+    if (micros() - triggerTime > PULSE_TIMEOUT) {
+        measurementPending = false;
+        echoState = ECHO_IDLE;
+        distance = INVALID_DISTANCE;
+        return true;
+    }
+    
+    return false;
+}
+
+void DistanceSensor::cancelMeasurement() {
+    measurementPending = false;
+    echoState = ECHO_IDLE;
+}
+
+void DistanceSensor::onEchoEdge(bool high, unsigned long timestampUs) {
+    if (high) {
+        if (echoState == ECHO_WAITING) {
+            echoStart = timestampUs;
+            echoState = ECHO_HIGH;
+        }
+    } else if (echoState == ECHO_HIGH) {
+        echoEnd = timestampUs;
+        echoState = ECHO_DONE;
+    }
+}
+
+void DistanceSensor::echoISR() {
+    if (captureInstance) {
+        captureInstance->onEchoEdge(digitalRead(captureInstance->echoPin) == HIGH, micros());
+    }
+}
+
 bool DistanceSensor::updateDistance() {
+    float distance;
+    bool collected = pollMeasurement(distance);
+    
+    // Nouvelle impulsion quand l'intervalle est écoulé et qu'aucune mesure n'est en vol
     unsigned long now = millis();
-    if (now - lastMeasure < MEASURE_INTERVAL) return false;
+    if (!measurementPending && now - lastMeasure >= MEASURE_INTERVAL) {
+        startMeasurement();
+        lastMeasure = now;
+        if (!captureMode) collected = pollMeasurement(distance);
+    }
     
-    float distance = measureDistance();
+    if (!collected) return false;
     
-    Serial.print("🔍 Distance mesurée: ");
-    Serial.print(distance);
-    Serial.println(" cm");
+    logEvent<LOG_DISTANCE, LOG_LEVEL_DEBUG>(EVT_DISTANCE_MM, (int32_t)(distance * 10));
     
     if (distance < INVALID_DISTANCE) {
         lastValidDistance = distance;
     }
     
-    lastMeasure = now;
     return true;
 }
 
@@ -52,4 +147,4 @@ float DistanceSensor::getLastValidDistance() const {
 
 bool DistanceSensor::isObstacleDetected(float threshold) const {
     return (lastValidDistance <= threshold && lastValidDistance > 0);
-}
\ No newline at end of file
+}
@@ -4,6 +4,13 @@
 #include <Arduino.h>
 #include "config.h"
 
+enum EchoState {
+    ECHO_IDLE,
+    ECHO_WAITING,   // Impulsion envoyée, front montant attendu
+    ECHO_HIGH,      // Écho en cours
+    ECHO_DONE       // Durée disponible
+};
+
 class DistanceSensor {
 private:
     int trigPin;
@@ -11,6 +18,20 @@ private:
     float lastValidDistance;
     unsigned long lastMeasure;
     
+    // Capture de l'écho par interruption
+    bool captureMode;
+    bool measurementPending;
+    unsigned long triggerTime;
+    volatile EchoState echoState;
+    volatile unsigned long echoStart;
+    volatile unsigned long echoEnd;
+    
+    static DistanceSensor* captureInstance;
+    static void echoISR();
+    
+    void sendTrigger();
+    static float durationToDistance(unsigned long duration);
+    
 public:
     DistanceSensor(int trig, int echo);
     void init();
@@ -18,6 +39,14 @@ public:
     bool updateDistance();
     float getLastValidDistance() const;
     bool isObstacleDetected(float threshold = OBSTACLE_DISTANCE_CM) const;
+    
+    // Mesure non bloquante : déclenchement puis relève du résultat
+    void startMeasurement();
+    bool pollMeasurement(float& distance);
+    void cancelMeasurement();
+    
+    // Front d'écho horodaté (appelé par l'ISR, ou par un banc hôte pour injecter des timings)
+    void onEchoEdge(bool high, unsigned long timestampUs);
 };
 
-#endif
\ No newline at end of file
+#endif
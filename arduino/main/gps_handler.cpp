@@ -1,30 +1,129 @@
 #include "gps_handler.h"
+#include "logger.h"
 #include <math.h>
 
 GPSHandler::GPSHandler() 
-    : currentLat(0.0), currentLng(0.0), positionValid(false) {
-    gpsSerial = new SoftwareSerial(GPS_RX_PIN, GPS_TX_PIN);
-}
-
-GPSHandler::~GPSHandler() {
-    delete gpsSerial;
+    : mode(GPS_MODE_NMEA), modeStart(0), currentLat(0.0), currentLng(0.0), positionValid(false),
+      groundSpeed(0.0), course(0.0), horizontalAccuracy(0.0), fixTime(0), fixCount(0),
+      lastNmeaEpoch(0xFFFFFFFF), bytesReceived(0), overflowCount(0) {
 }
 
 void GPSHandler::init() {
-    gpsSerial->begin(GPS_BAUD);
+    if (GPS_UBX_MODE) {
+        configureUbx();
+    } else {
+        GPS_SERIAL.begin(GPS_BAUD);
+    }
     Serial.println("✅ GPS initialisé");
 }
 
+void GPSHandler::configureUbx() {
+    // CFG-PRT : UART1 en 8N1 à GPS_UBX_BAUD, entrée UBX+NMEA, sortie UBX seule
+    const uint32_t baud = GPS_UBX_BAUD;
+    const uint8_t port[20] = {
+        0x01, 0x00, 0x00, 0x00,
+        0xD0, 0x08, 0x00, 0x00,
+        (uint8_t)(baud), (uint8_t)(baud >> 8), (uint8_t)(baud >> 16), (uint8_t)(baud >> 24),
+        0x03, 0x00, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00
+    };
+    // CFG-RATE : période de mesure, 1 mesure par solution, référence GPS
+    const uint8_t rate[6] = {
+        (uint8_t)(GPS_UBX_RATE_MS & 0xFF), (uint8_t)(GPS_UBX_RATE_MS >> 8), 0x01, 0x00, 0x01, 0x00
+    };
+    // CFG-MSG : NAV-PVT à chaque solution sur le port courant
+    const uint8_t message[3] = { UBX_CLASS_NAV, UBX_NAV_PVT, 0x01 };
+    
+    // Envoyé aux deux vitesses : après un redémarrage de la carte seule, le récepteur
+    // est encore à GPS_UBX_BAUD
+    GPS_SERIAL.begin(GPS_BAUD);
+    sendUbx(UBX_CLASS_CFG, UBX_CFG_PRT, port, sizeof(port));
+    GPS_SERIAL.flush();
+    GPS_SERIAL.end();
+    
+    GPS_SERIAL.begin(GPS_UBX_BAUD);
+    sendUbx(UBX_CLASS_CFG, UBX_CFG_PRT, port, sizeof(port));
+    GPS_SERIAL.flush();
+    delay(100);  // Le récepteur change de vitesse après son acquittement
+    
+    sendUbx(UBX_CLASS_CFG, UBX_CFG_RATE, rate, sizeof(rate));
+    sendUbx(UBX_CLASS_CFG, UBX_CFG_MSG, message, sizeof(message));
+    
+    mode = GPS_MODE_UBX_PENDING;
+    modeStart = millis();
+}
+
+void GPSHandler::sendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t* data, uint16_t length) {
+    uint8_t frame[32];
+    size_t size = UbxParser::buildFrame(msgClass, msgId, data, length, frame, sizeof(frame));
+    if (size > 0) GPS_SERIAL.write(frame, size);
+}
+
 void GPSHandler::update() {
-    while (gpsSerial->available() > 0) {
-        if (gps.encode(gpsSerial->read())) {
-            if (gps.location.isValid()) {
-                currentLat = gps.location.lat();
-                currentLng = gps.location.lng();
-                positionValid = true;
-            }
+    // L'interruption UART remplit le tampon ; on le vide par tranches bornées
+    int pending = GPS_SERIAL.available();
+    if (pending >= (int)GPS_UART_BUFFER_SIZE - 1) {
+        overflowCount++;
+    }
+    
+    uint8_t budget = GPS_BYTES_PER_TICK;
+    while (budget-- > 0 && GPS_SERIAL.available() > 0) {
+        int c = GPS_SERIAL.read();
+        if (c < 0) break;
+        bytesReceived++;
+        
+        if (mode == GPS_MODE_NMEA) {
+            if (gps.encode((char)c)) applyNmea();
+        } else if (ubx.encode((uint8_t)c)) {
+            mode = GPS_MODE_UBX;
+            applyNavPvt();
         }
     }
+    
+    // Récepteur non u-blox : aucune trame UBX, retour au NMEA à la vitesse d'origine
+    if (mode == GPS_MODE_UBX_PENDING && millis() - modeStart > GPS_UBX_DETECT_TIMEOUT) {
+        GPS_SERIAL.end();
+        GPS_SERIAL.begin(GPS_BAUD);
+        mode = GPS_MODE_NMEA;
+        logText<LOG_GPS, LOG_LEVEL_WARN>("GPS: pas de trame UBX, repli NMEA");
+    }
+}
+
+void GPSHandler::applyNavPvt() {
+    // Lecture sur place de la charge utile vérifiée
+    UbxNavPvtView pvt = ubx.navPvt();
+    if (!pvt.gnssFixOK() || pvt.fixType() < 2) return;
+    
+    currentLat = pvt.lat() * 1e-7;
+    currentLng = pvt.lon() * 1e-7;
+    groundSpeed = pvt.gSpeed() * 0.001f;
+    course = pvt.headMot() * 1e-5f;
+    horizontalAccuracy = pvt.hAcc() * 0.001f;
+    fixTime = millis();
+    fixCount++;
+    positionValid = true;
+}
+
+void GPSHandler::applyNmea() {
+    if (!gps.location.isUpdated() || !gps.location.isValid()) return;
+    
+    currentLat = gps.location.lat();
+    currentLng = gps.location.lng();
+    if (gps.speed.isValid()) groundSpeed = gps.speed.mps();
+    if (gps.course.isValid()) course = gps.course.deg();
+    // NMEA ne donne pas la précision : estimation à partir du HDOP
+    if (gps.hdop.isValid()) horizontalAccuracy = gps.hdop.hdop() * GPS_NMEA_UERE;
+    
+    // GGA et RMC portent le même point : un seul nouveau point par heure UTC,
+    // sinon l'EKF fusionnerait deux fois la même mesure
+    if (gps.time.isValid()) {
+        uint32_t epoch = gps.time.value();
+        if (epoch == lastNmeaEpoch) return;
+        lastNmeaEpoch = epoch;
+    }
+    fixTime = millis();
+    fixCount++;
+    positionValid = true;
 }
 
 bool GPSHandler::isPositionValid() const {
@@ -39,6 +138,42 @@ double GPSHandler::getCurrentLongitude() const {
     return currentLng;
 }
 
+float GPSHandler::getGroundSpeed() const {
+    return groundSpeed;
+}
+
+float GPSHandler::getCourse() const {
+    return course;
+}
+
+float GPSHandler::getHorizontalAccuracy() const {
+    return horizontalAccuracy;
+}
+
+unsigned long GPSHandler::getFixTime() const {
+    return fixTime;
+}
+
+unsigned long GPSHandler::getFixCount() const {
+    return fixCount;
+}
+
+GpsMode GPSHandler::getMode() const {
+    return mode;
+}
+
+unsigned long GPSHandler::getBytesReceived() const {
+    return bytesReceived;
+}
+
+unsigned long GPSHandler::getOverflowCount() const {
+    return overflowCount;
+}
+
+unsigned long GPSHandler::getFailedSentences() const {
+    return mode == GPS_MODE_NMEA ? gps.failedChecksum() : ubx.getChecksumErrors();
+}
+
 void GPSHandler::printPosition() const {
     if (positionValid) {
         Serial.print("GPS: ");
@@ -81,27 +216,32 @@ double GPSHandler::calculateBearing(double lat1, double lng1, double lat2, doubl
     return bearing;
 }
 
-double GPSHandler::parseDMS(String dms) {
-    // Parse "48°50'18"N" vers décimal
-    dms.trim();
+double GPSHandler::parseDMS(const char* dms, size_t length) {
+    // Parse "48°50'18"N" vers décimal, sans allocation
+    const char* end = dms + length;
+    while (dms < end && *dms == ' ') dms++;
+    while (end > dms && end[-1] == ' ') end--;
+    if (dms == end) return NAN;
     
-    int deg_pos = dms.indexOf('°');
-    int min_pos = dms.indexOf('\'');
-    int sec_pos = dms.indexOf('"');
+    // Le symbole ° est encodé en UTF-8 (0xC2 0xB0) : on repère son dernier octet
+    const char* deg_pos = (const char*)memchr(dms, (char)0xB0, end - dms);
+    if (deg_pos == NULL) return NAN;
+    const char* min_pos = (const char*)memchr(deg_pos, '\'', end - deg_pos);
+    if (min_pos == NULL) return NAN;
+    const char* sec_pos = (const char*)memchr(min_pos, '"', end - min_pos);
+    if (sec_pos == NULL) return NAN;
     
-    if (deg_pos == -1 || min_pos == -1 || sec_pos == -1) return NAN;
-    
-    double degrees = dms.substring(0, deg_pos).toFloat();
-    double minutes = dms.substring(deg_pos + 1, min_pos).toFloat();
-    double seconds = dms.substring(min_pos + 1, sec_pos).toFloat();
+    double degrees = atof(dms);
+    double minutes = atof(deg_pos + 1);
+    double seconds = atof(min_pos + 1);
     
     double decimal = degrees + (minutes / 60.0) + (seconds / 3600.0);
     
     // Vérifier la direction (N/S pour latitude, E/W pour longitude)
-    char direction = dms.charAt(dms.length() - 1);
-    if (direction == 'S' || direction == 'W') {
+    char direction = end[-1];
+    if (direction == 'S' || direction == 's' || direction == 'W' || direction == 'w') {
         decimal = -decimal;
     }
     
     return decimal;
-}
\ No newline at end of file
+}
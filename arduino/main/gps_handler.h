@@ -2,31 +2,63 @@
 #define GPS_HANDLER_H
 
 #include <Arduino.h>
-#include <SoftwareSerial.h>
 #include <TinyGPS++.h>
 #include "config.h"
+#include "ubx_parser.h"
+
+enum GpsMode {
+    GPS_MODE_NMEA,
+    GPS_MODE_UBX_PENDING,   // Configuration envoyée, en attente de la première trame
+    GPS_MODE_UBX
+};
 
 class GPSHandler {
 private:
     TinyGPSPlus gps;
-    SoftwareSerial* gpsSerial;
+    UbxParser ubx;
+    GpsMode mode;
+    unsigned long modeStart;
+    
     double currentLat, currentLng;
     bool positionValid;
+    float groundSpeed;          // m/s
+    float course;               // degrés
+    float horizontalAccuracy;   // m
+    unsigned long fixTime;      // millis() du dernier point
+    unsigned long fixCount;
+    uint32_t lastNmeaEpoch;     // Heure UTC (hhmmsscc) du dernier point NMEA compté
+    
+    // Télémétrie de réception
+    unsigned long bytesReceived;
+    unsigned long overflowCount;   // Passages où le tampon UART était plein (octets perdus)
+    
+    void configureUbx();
+    void sendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t* data, uint16_t length);
+    void applyNavPvt();
+    void applyNmea();
     
 public:
     GPSHandler();
-    ~GPSHandler();
     void init();
     void update();
     bool isPositionValid() const;
     double getCurrentLatitude() const;
     double getCurrentLongitude() const;
+    float getGroundSpeed() const;
+    float getCourse() const;
+    float getHorizontalAccuracy() const;
+    unsigned long getFixTime() const;
+    unsigned long getFixCount() const;    // Change à chaque nouveau point
+    GpsMode getMode() const;
+    unsigned long getBytesReceived() const;
+    unsigned long getOverflowCount() const;
+    unsigned long getFailedSentences() const;   // Phrases NMEA rejetées (somme de contrôle)
     void printPosition() const;
     
     // Calculs géographiques statiques
     static double calculateDistance(double lat1, double lng1, double lat2, double lng2);
     static double calculateBearing(double lat1, double lng1, double lat2, double lng2);
-    static double parseDMS(String dms);
+    static double parseDMS(const char* dms, size_t length);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "gyro_bias.h"
+#include "config.h"
+#include <math.h>
+
+GyroBiasEstimator::GyroBiasEstimator()
+    : offset(0.0f), slope(0.0f), valid(false), updates(0),
+      weight(0.0f), sumT(0.0f), sumB(0.0f), sumTT(0.0f), sumTB(0.0f),
+      count(0), sum(0.0f), sumSquares(0.0f), sumTemperature(0.0f) {
+}
+
+float GyroBiasEstimator::getBias(float temperature) const {
+    return offset + slope * (temperature - MPU_BIAS_REFERENCE_TEMP);
+}
+
+bool GyroBiasEstimator::addSample(float rawRate, float temperature, bool stationary) {
+    if (!stationary) {
+        resetWindow();
+        return false;
+    }
+    
+    float deviation = rawRate - getBias(temperature);
+    sum += deviation;
+    sumSquares += deviation * deviation;
+    sumTemperature += temperature;
+    if (++count < MPU_ZUPT_WINDOW) return false;
+    
+    float mean = sum / count;
+    float variance = sumSquares / count - mean * mean;
+    float meanTemperature = sumTemperature / count;
+    resetWindow();
+    
+    // Robot poussé ou vibrations : la fenêtre ne mesure pas le biais
+    if (variance > MPU_ZUPT_MAX_STDDEV * MPU_ZUPT_MAX_STDDEV) return false;
+    if (valid && fabsf(mean) > MPU_ZUPT_MAX_STEP) return false;
+    
+    addPoint(meanTemperature, getBias(meanTemperature) + mean);
+    updates++;
+    return true;
+}
+
+void GyroBiasEstimator::addPoint(float temperature, float biasValue) {
+    float t = temperature - MPU_BIAS_REFERENCE_TEMP;
+    
+    weight = weight * MPU_BIAS_FORGETTING + 1.0f;
+    sumT = sumT * MPU_BIAS_FORGETTING + t;
+    sumB = sumB * MPU_BIAS_FORGETTING + biasValue;
+    sumTT = sumTT * MPU_BIAS_FORGETTING + t * t;
+    sumTB = sumTB * MPU_BIAS_FORGETTING + t * biasValue;
+    
+    float meanT = sumT / weight;
+    float meanB = sumB / weight;
+    float varianceT = sumTT / weight - meanT * meanT;
+    
+    // Pente réestimée seulement avec assez d'écart de température ; sinon conservée
+    if (varianceT >= MPU_BIAS_MIN_TEMP_SPREAD * MPU_BIAS_MIN_TEMP_SPREAD) {
+        slope = (sumTB / weight - meanT * meanB) / varianceT;
+    }
+    offset = meanB - slope * meanT;
+    valid = true;
+}
+
+void GyroBiasEstimator::setBias(float value, float temperature) {
+    weight = 0.0f;
+    sumT = sumB = sumTT = sumTB = 0.0f;
+    addPoint(temperature, value);
+    resetWindow();
+}
+
+void GyroBiasEstimator::setModel(float modelOffset, float modelSlope) {
+    offset = modelOffset;
+    slope = modelSlope;
+    valid = true;
+    weight = 0.0f;
+    sumT = sumB = sumTT = sumTB = 0.0f;
+    resetWindow();
+}
+
+void GyroBiasEstimator::resetWindow() {
+    count = 0;
+    sum = 0.0f;
+    sumSquares = 0.0f;
+    sumTemperature = 0.0f;
+}
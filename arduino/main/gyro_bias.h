@@ -0,0 +1,52 @@
+#ifndef GYRO_BIAS_H
+#define GYRO_BIAS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Estimation continue du biais du gyroscope par mises à jour à vitesse nulle.
+// Les échantillons bruts sont regroupés en fenêtres ; une fenêtre entièrement
+// immobile (moteurs arrêtés) et peu bruitée fournit un point (température, biais).
+// Le modèle biais = offset + pente × (T - MPU_BIAS_REFERENCE_TEMP) est ajusté par
+// moindres carrés à oubli exponentiel ; la pente n'est estimée que si les points
+// couvrent un écart de température suffisant.
+class GyroBiasEstimator {
+private:
+    float offset;     // Biais à la température de référence (°/s)
+    float slope;      // °/s par °C
+    bool valid;
+    uint32_t updates;
+    
+    // Sommes pondérées des points (température centrée, biais)
+    float weight;
+    float sumT, sumB, sumTT, sumTB;
+    
+    // Fenêtre en cours (écarts au modèle courant, pour garder des petites valeurs)
+    uint16_t count;
+    float sum;
+    float sumSquares;
+    float sumTemperature;
+    
+    void addPoint(float temperature, float biasValue);
+    
+public:
+    GyroBiasEstimator();
+    
+    // rawRate : vitesse brute (°/s), temperature : °C ;
+    // retourne true si le modèle vient d'être mis à jour
+    bool addSample(float rawRate, float temperature, bool stationary);
+    
+    // Calibration explicite à une température donnée
+    void setBias(float value, float temperature);
+    // Modèle restauré depuis la mémoire non volatile
+    void setModel(float modelOffset, float modelSlope);
+    void resetWindow();
+    
+    float getBias(float temperature) const;
+    float getOffset() const { return offset; }
+    float getSlope() const { return slope; }
+    bool isValid() const { return valid; }
+    uint32_t getUpdateCount() const { return updates; }
+};
+
+#endif
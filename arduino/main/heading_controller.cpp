@@ -0,0 +1,65 @@
+#include "heading_controller.h"
+#include "config.h"
+#include <math.h>
+
+static float clampSymmetric(float value, float limit) {
+    if (value > limit) return limit;
+    if (value < -limit) return -limit;
+    return value;
+}
+
+HeadingController::HeadingController()
+    : integral(0.0f), output(0.0f) {
+}
+
+void HeadingController::reset() {
+    integral = 0.0f;
+    output = 0.0f;
+}
+
+float HeadingController::update(float error, float rate, float dt) {
+    if (dt <= 0.0f) return output;
+    
+    float proportional = HEADING_KP * error;
+    float derivative = HEADING_KD * rate;
+    
+    // Intégration conditionnelle : seulement près du cap, et pas si elle aggrave une saturation
+    if (fabsf(error) < HEADING_INTEGRAL_ZONE) {
+        float candidate = integral + error * dt;
+        float command = proportional + HEADING_KI * candidate - derivative;
+        if (fabsf(command) < HEADING_MAX_DIFF || (command > 0.0f) != (error > 0.0f)) {
+            integral = clampSymmetric(candidate, HEADING_INTEGRAL_LIMIT / HEADING_KI);
+        }
+    } else {
+        integral = 0.0f;
+    }
+    
+    float command = clampSymmetric(proportional + HEADING_KI * integral - derivative, HEADING_MAX_DIFF);
+    
+    // Limitation de pente : pas d'à-coup sur les roues
+    float maxStep = HEADING_SLEW_RATE * dt;
+    output += clampSymmetric(command - output, maxStep);
+    return output;
+}
+
+void HeadingController::mix(float forwardPwm, float turn, float headingError, int& left, int& right) {
+    float scale = cosf(headingError * (float)M_PI / 180.0f);
+    float base = scale > 0.0f ? forwardPwm * scale : 0.0f;
+    
+    float leftPwm = base + turn;
+    float rightPwm = base - turn;
+    
+    // Saturation d'une roue : on décale les deux pour garder le différentiel
+    float high = leftPwm > rightPwm ? leftPwm : rightPwm;
+    float low = leftPwm < rightPwm ? leftPwm : rightPwm;
+    if (high > MOTOR_MAX_PWM) {
+        leftPwm -= high - MOTOR_MAX_PWM;
+        rightPwm -= high - MOTOR_MAX_PWM;
+    } else if (low < -MOTOR_MAX_PWM) {
+        leftPwm += -MOTOR_MAX_PWM - low;
+        rightPwm += -MOTOR_MAX_PWM - low;
+    }
+    
+    left = (int)lroundf(clampSymmetric(leftPwm, MOTOR_MAX_PWM));
+    right = (int)lroundf(clampSymmetric(rightPwm, MOTOR_MAX_PWM));
+}
@@ -0,0 +1,35 @@
+#ifndef HEADING_CONTROLLER_H
+#define HEADING_CONTROLLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Régulateur de cap PID : l'erreur de cap devient un différentiel de vitesse
+// entre les roues, appliqué en roulant (plus de rotation sur place puis arrêt).
+// Le terme dérivé porte sur la vitesse de rotation mesurée par le gyroscope
+// (pas de saut de consigne au changement de cible) ; l'intégrale n'agit que
+// près du cap et s'arrête quand la sortie sature (anti-windup). La sortie est
+// limitée en amplitude et en pente.
+class HeadingController {
+private:
+    float integral;   // Somme des erreurs (°·s)
+    float output;     // Dernier différentiel appliqué (PWM)
+    
+public:
+    HeadingController();
+    void reset();
+    
+    // error : cap cible - cap (°, normalisé ±180), rate : rotation mesurée (°/s, positive à droite),
+    // dt : s ; retourne le différentiel PWM (positif = tourner à droite)
+    float update(float error, float rate, float dt);
+    
+    // Consignes des roues (PWM signé) : l'avance diminue avec l'erreur de cap et
+    // s'annule au-delà de 90° (rotation sur place) ; le différentiel est conservé
+    // en cas de saturation d'une roue
+    static void mix(float forwardPwm, float turn, float headingError, int& left, int& right);
+    
+    float getOutput() const { return output; }
+    float getIntegral() const { return integral; }
+};
+
+#endif
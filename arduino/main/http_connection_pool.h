@@ -0,0 +1,211 @@
+#ifndef HTTP_CONNECTION_POOL_H
+#define HTTP_CONNECTION_POOL_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// Build hôte : l'horloge est fournie par le banc de test (fausses micros() et millis())
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+unsigned long micros();
+unsigned long millis();
+#endif
+
+#include "config.h"
+#include "line_assembler.h"
+
+enum HttpParseState {
+    HTTP_REQUEST_LINE,
+    HTTP_HEADERS
+};
+
+// Connexion HTTP/1.1 persistante avec son analyseur incrémental
+template <typename Client>
+struct HttpConnection {
+    Client client;
+    bool active;
+    HttpParseState state;
+    bool keepAlive;
+    unsigned long lastActivity;
+    unsigned long requestStart;
+    unsigned long requestStartUs;   // Mesure de latence (section PROFILE_HTTP_REQUEST)
+    LineAssembler<REQUEST_LINE_MAX> line;
+    char requestLine[REQUEST_LINE_MAX];
+    
+    // Flux Server-Sent Events (/stream)
+    bool streaming;
+    unsigned long streamInterval;
+    unsigned long lastEvent;
+};
+
+// Emplacements de connexion, analyse des requêtes et persistance, sans rien savoir
+// des réponses : WiFiServer/WiFiClient sur la carte, faux sockets sur l'hôte.
+// Server doit fournir accept() ; Client : operator bool, connected(), available(),
+// read() et stop().
+template <typename Server, typename Client>
+class HttpConnectionPool {
+public:
+    typedef HttpConnection<Client> Connection;
+    typedef void (*ConnectionCallback)(void* context, Connection& connection);
+    
+private:
+    Server& server;
+    Connection connections[MAX_HTTP_CONNECTIONS];
+    uint8_t nextSlot;   // Premier emplacement servi au prochain passage (tourniquet)
+    
+    ConnectionCallback requestCallback;   // Requête complète (connection.requestLine) à traiter
+    ConnectionCallback streamCallback;    // Flux ouvert : événement dû
+    void* callbackContext;
+    
+    void acceptClients() {
+        // Toutes les connexions en attente sont prises dans le même passage
+        for (uint8_t n = 0; n < MAX_HTTP_CONNECTIONS; n++) {
+            Client client = server.accept();
+            if (!client) return;
+            acceptClient(client);
+        }
+    }
+    
+    void acceptClient(Client& client) {
+        // Emplacement libre, sinon on libère la connexion la plus longtemps inactive
+        Connection* slot = NULL;
+        for (uint8_t i = 0; i < MAX_HTTP_CONNECTIONS; i++) {
+            if (!connections[i].active) {
+                slot = &connections[i];
+                break;
+            }
+            if (slot == NULL || connections[i].lastActivity < slot->lastActivity) {
+                slot = &connections[i];
+            }
+        }
+        if (slot->active) close(*slot);
+        
+        slot->client = client;
+        slot->active = true;
+        slot->state = HTTP_REQUEST_LINE;
+        slot->keepAlive = true;
+        slot->lastActivity = millis();
+        slot->requestStart = slot->lastActivity;
+        slot->requestStartUs = micros();
+        slot->line.reset();
+        slot->requestLine[0] = '\0';
+        slot->streaming = false;
+    }
+    
+    void service(Connection& connection) {
+        unsigned long now = millis();
+        
+        if (!connection.client.connected()) {
+            close(connection);
+            return;
+        }
+        
+        // Flux d'état : un événement par intervalle, le client n'envoie plus rien
+        if (connection.streaming) {
+            uint8_t budget = HTTP_BYTES_PER_TICK;
+            while (budget-- > 0 && connection.client.available() > 0) connection.client.read();
+            if (now - connection.lastEvent >= connection.streamInterval) {
+                streamCallback(callbackContext, connection);
+            }
+            return;
+        }
+        
+        // Lecture bornée : jamais d'attente active sur un socket
+        uint8_t budget = HTTP_BYTES_PER_TICK;
+        while (budget-- > 0 && connection.client.available() > 0) {
+            int c = connection.client.read();
+            if (c < 0) break;
+            connection.lastActivity = now;
+            
+            if (connection.line.feed((char)c)) {
+                // Une requête par passage et par client : les suivantes attendent leur tour
+                bool answered = handleLine(connection, connection.line.line());
+                if (!connection.active) return;
+                if (answered) break;
+            }
+        }
+        
+        // Requête commencée mais jamais terminée, ou connexion inactive trop longtemps
+        bool midRequest = connection.state == HTTP_HEADERS || connection.line.isPartial();
+        if (midRequest && now - connection.requestStart > HTTP_REQUEST_TIMEOUT) {
+            close(connection);
+        } else if (now - connection.lastActivity > HTTP_KEEPALIVE_TIMEOUT) {
+            close(connection);
+        }
+    }
+    
+    bool handleLine(Connection& connection, char* line) {
+        if (connection.state == HTTP_REQUEST_LINE) {
+            if (line[0] == '\0') return false;  // Lignes vides entre deux requêtes
+            
+            strncpy(connection.requestLine, line, REQUEST_LINE_MAX - 1);
+            connection.requestLine[REQUEST_LINE_MAX - 1] = '\0';
+            connection.requestStart = millis();
+            connection.requestStartUs = micros();
+            // HTTP/1.1 : persistante par défaut, HTTP/1.0 : fermée par défaut
+            connection.keepAlive = strstr(line, "HTTP/1.1") != NULL;
+            connection.state = HTTP_HEADERS;
+            return false;
+        }
+        
+        if (line[0] != '\0') {
+            // Seul l'en-tête Connection nous intéresse
+            if (strncasecmp(line, "Connection:", 11) == 0) {
+                const char* value = line + 11;
+                while (*value == ' ') value++;
+                if (strncasecmp(value, "close", 5) == 0) connection.keepAlive = false;
+                else if (strncasecmp(value, "keep-alive", 10) == 0) connection.keepAlive = true;
+            }
+            return false;
+        }
+        
+        // Ligne vide : fin des en-têtes, la requête est complète
+        requestCallback(callbackContext, connection);
+        connection.state = HTTP_REQUEST_LINE;
+        
+        if (connection.active && !connection.keepAlive && !connection.streaming) close(connection);
+        return true;
+    }
+    
+public:
+    HttpConnectionPool(Server& listener, ConnectionCallback onRequest, ConnectionCallback onStreamEvent,
+                       void* context)
+        : server(listener), nextSlot(0), requestCallback(onRequest), streamCallback(onStreamEvent),
+          callbackContext(context) {
+        for (uint8_t i = 0; i < MAX_HTTP_CONNECTIONS; i++) {
+            connections[i].active = false;
+        }
+    }
+    
+    // Un passage : nouvelles connexions puis lecture bornée de chaque socket
+    void poll() {
+        acceptClients();
+        
+        // Tourniquet : le premier servi change à chaque passage, aucun client n'est
+        // systématiquement derrière les autres (tampon de réponse et pont WiFi partagés)
+        for (uint8_t n = 0; n < MAX_HTTP_CONNECTIONS; n++) {
+            Connection& connection = connections[(nextSlot + n) % MAX_HTTP_CONNECTIONS];
+            if (connection.active) service(connection);
+        }
+        nextSlot = (nextSlot + 1) % MAX_HTTP_CONNECTIONS;
+    }
+    
+    void close(Connection& connection) {
+        connection.client.stop();
+        connection.active = false;
+    }
+    
+    const Connection& getConnection(uint8_t slot) const { return connections[slot]; }
+    
+    uint8_t getActiveCount() const {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < MAX_HTTP_CONNECTIONS; i++) {
+            if (connections[i].active) count++;
+        }
+        return count;
+    }
+};
+
+#endif
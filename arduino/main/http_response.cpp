@@ -0,0 +1,75 @@
+#include "http_response.h"
+#include <stdio.h>
+
+HttpResponse::HttpResponse(char* storage, size_t size)
+    : buffer(storage), capacity(size), bodyLength(0), headerStart(HTTP_HEADER_RESERVE), overflow(false) {
+}
+
+void HttpResponse::clear() {
+    bodyLength = 0;
+    headerStart = HTTP_HEADER_RESERVE;
+    overflow = false;
+}
+
+size_t HttpResponse::write(uint8_t c) {
+    if (HTTP_HEADER_RESERVE + bodyLength >= capacity) {
+        overflow = true;
+        return 0;
+    }
+    buffer[HTTP_HEADER_RESERVE + bodyLength++] = c;
+    return 1;
+}
+
+size_t HttpResponse::write(const uint8_t* data, size_t size) {
+    size_t available = capacity - HTTP_HEADER_RESERVE - bodyLength;
+    if (size > available) {
+        overflow = true;
+        size = available;
+    }
+    memcpy(buffer + HTTP_HEADER_RESERVE + bodyLength, data, size);
+    bodyLength += size;
+    return size;
+}
+
+char* HttpResponse::reserveBody(size_t& available) {
+    available = capacity - HTTP_HEADER_RESERVE - bodyLength;
+    return buffer + HTTP_HEADER_RESERVE + bodyLength;
+}
+
+void HttpResponse::commitBody(size_t length) {
+    size_t available = capacity - HTTP_HEADER_RESERVE - bodyLength;
+    bodyLength += length < available ? length : available;
+}
+
+const uint8_t* HttpResponse::finish(const char* contentType, bool keepAlive, size_t& length) {
+    char headers[HTTP_HEADER_RESERVE];
+    int headerLength;
+    
+    if (contentType) {
+        headerLength = snprintf(headers, sizeof(headers),
+                                "HTTP/1.1 200 OK\r\n"
+                                "Content-Type: %s\r\n"
+                                "Access-Control-Allow-Origin: *\r\n"
+                                "Content-Length: %u\r\n"
+                                "Connection: %s\r\n\r\n",
+                                contentType, (unsigned int)bodyLength, keepAlive ? "keep-alive" : "close");
+    } else {
+        headerLength = snprintf(headers, sizeof(headers),
+                                "HTTP/1.1 200 OK\r\n"
+                                "Access-Control-Allow-Origin: *\r\n"
+                                "Content-Length: %u\r\n"
+                                "Connection: %s\r\n\r\n",
+                                (unsigned int)bodyLength, keepAlive ? "keep-alive" : "close");
+    }
+    
+    if (headerLength < 0 || (size_t)headerLength >= sizeof(headers)) {
+        length = 0;
+        return (const uint8_t*)buffer;
+    }
+    
+    headerStart = HTTP_HEADER_RESERVE - headerLength;
+    memcpy(buffer + headerStart, headers, headerLength);
+    
+    length = headerLength + bodyLength;
+    return (const uint8_t*)(buffer + headerStart);
+}
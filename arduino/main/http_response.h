@@ -0,0 +1,39 @@
+#ifndef HTTP_RESPONSE_H
+#define HTTP_RESPONSE_H
+
+#include <Arduino.h>
+
+const size_t HTTP_HEADER_RESERVE = 160;
+
+// Réponse HTTP complète dans un tampon fixe, envoyée en une seule écriture.
+// Le corps est écrit après une zone réservée ; les en-têtes (dont Content-Length)
+// sont formatés à la fin et placés juste devant le corps, sans recopie du corps.
+class HttpResponse : public Print {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t bodyLength;
+    size_t headerStart;
+    bool overflow;
+    
+public:
+    HttpResponse(char* storage, size_t size);
+    
+    void clear();
+    virtual size_t write(uint8_t c);
+    virtual size_t write(const uint8_t* data, size_t size);
+    using Print::write;
+    
+    // Écriture directe dans le corps (ex. snprintf), validée par commitBody()
+    char* reserveBody(size_t& available);
+    void commitBody(size_t length);
+    
+    // Formate les en-têtes ; retourne la réponse complète et sa longueur
+    const uint8_t* finish(const char* contentType, bool keepAlive, size_t& length);
+    
+    const uint8_t* getBody() const { return (const uint8_t*)(buffer + HTTP_HEADER_RESERVE); }
+    size_t getBodyLength() const { return bodyLength; }
+    bool isOverflow() const { return overflow; }
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "i2c_bus.h"
+
+I2cBus::I2cBus(I2cBackend& busBackend)
+    : backend(busBackend), head(0), tail(0), completed(0), errors(0), rejected(0) {
+}
+
+bool I2cBus::submit(const I2cTransaction& transaction) {
+    uint8_t next = (head + 1) & (I2C_QUEUE_SIZE - 1);
+    if (next == tail) {
+        rejected++;
+        return false;
+    }
+    queue[head] = transaction;
+    head = next;
+    return true;
+}
+
+bool I2cBus::submitRead(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length,
+                        I2cCallback callback, void* context) {
+    I2cTransaction transaction = { address, reg, data, length, true, callback, context };
+    return submit(transaction);
+}
+
+bool I2cBus::submitWrite(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length,
+                         I2cCallback callback, void* context) {
+    // Le tampon n'est jamais modifié pour une écriture
+    I2cTransaction transaction = { address, reg, const_cast<uint8_t*>(data), length, false, callback, context };
+    return submit(transaction);
+}
+
+uint8_t I2cBus::poll(uint8_t maxTransactions) {
+    uint8_t executed = 0;
+    
+    while (executed < maxTransactions && tail != head) {
+        // Copie locale : le rappel peut soumettre la transaction suivante
+        I2cTransaction transaction = queue[tail];
+        tail = (tail + 1) & (I2C_QUEUE_SIZE - 1);
+        
+        I2cStatus status = transaction.read
+            ? backend.readRegisters(transaction.address, transaction.reg, transaction.data, transaction.length)
+            : backend.writeRegisters(transaction.address, transaction.reg, transaction.data, transaction.length);
+        
+        if (status == I2C_OK) completed++;
+        else errors++;
+        
+        if (transaction.callback) transaction.callback(transaction.context, transaction, status);
+        executed++;
+    }
+    return executed;
+}
+
+uint8_t I2cBus::pending() const {
+    return (head - tail) & (I2C_QUEUE_SIZE - 1);
+}
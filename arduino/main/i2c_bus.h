@@ -0,0 +1,70 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t I2C_QUEUE_SIZE = 8;   // Puissance de 2
+
+enum I2cStatus {
+    I2C_OK,
+    I2C_NACK,
+    I2C_ERROR
+};
+
+struct I2cTransaction;
+typedef void (*I2cCallback)(void* context, const I2cTransaction& transaction, I2cStatus status);
+
+// Descripteur : lecture ou écriture de registres consécutifs d'un composant.
+// Le tampon appartient à l'appelant et doit rester valide jusqu'au rappel.
+struct I2cTransaction {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t* data;
+    uint8_t length;
+    bool read;
+    I2cCallback callback;   // Optionnel
+    void* context;
+};
+
+// Accès matériel (Wire sur la carte, faux bus sur l'hôte)
+class I2cBackend {
+public:
+    virtual I2cStatus writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) = 0;
+    virtual I2cStatus readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) = 0;
+};
+
+// File de transactions partagée par tous les composants I2C.
+// Les modules soumettent des descripteurs sans attendre ; poll(), cadencé par
+// l'ordonnanceur, exécute un nombre borné de transactions et appelle les rappels.
+class I2cBus {
+private:
+    I2cBackend& backend;
+    I2cTransaction queue[I2C_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t tail;
+    
+    unsigned long completed;
+    unsigned long errors;
+    unsigned long rejected;   // File pleine
+    
+public:
+    explicit I2cBus(I2cBackend& busBackend);
+    
+    bool submit(const I2cTransaction& transaction);
+    bool submitRead(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length,
+                    I2cCallback callback, void* context);
+    bool submitWrite(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length,
+                     I2cCallback callback = NULL, void* context = NULL);
+    
+    // Exécute au plus maxTransactions transactions ; retourne le nombre exécuté
+    uint8_t poll(uint8_t maxTransactions = 1);
+    
+    uint8_t pending() const;
+    bool isIdle() const { return head == tail; }
+    unsigned long getCompleted() const { return completed; }
+    unsigned long getErrors() const { return errors; }
+    unsigned long getRejected() const { return rejected; }
+};
+
+#endif
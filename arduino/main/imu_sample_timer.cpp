@@ -0,0 +1,40 @@
+#include "imu_sample_timer.h"
+
+ImuSampleTimer::ImuSampleTimer()
+    : head(0), tail(0), dropped(0), lastTimestamp(0), hasLast(false) {
+}
+
+void ImuSampleTimer::onDataReady(unsigned long timestampUs) {
+    uint8_t next = (head + 1) & (IMU_TIMESTAMP_QUEUE_SIZE - 1);
+    if (next == tail) {
+        dropped++;   // File pleine : le consommateur est en retard
+        return;
+    }
+    timestamps[head] = timestampUs;
+    head = next;     // Publié après l'écriture de la valeur
+}
+
+uint8_t ImuSampleTimer::pending() const {
+    return (head - tail) & (IMU_TIMESTAMP_QUEUE_SIZE - 1);
+}
+
+bool ImuSampleTimer::nextInterval(float& dt, float nominalDt) {
+    if (tail == head) return false;
+    
+    unsigned long timestamp = timestamps[tail];
+    tail = (tail + 1) & (IMU_TIMESTAMP_QUEUE_SIZE - 1);
+    
+    // Premier échantillon après une remise à zéro : pas de référence, période nominale.
+    // Un intervalle de plus d'une période et demie trahit une interruption manquée :
+    // l'échantillon non horodaté a déjà compté une période nominale.
+    dt = hasLast ? (timestamp - lastTimestamp) / 1000000.0f : nominalDt;
+    if (dt > 1.5f * nominalDt) dt = nominalDt;
+    lastTimestamp = timestamp;
+    hasLast = true;
+    return true;
+}
+
+void ImuSampleTimer::clear() {
+    tail = head;
+    hasLast = false;
+}
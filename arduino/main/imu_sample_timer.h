@@ -0,0 +1,44 @@
+#ifndef IMU_SAMPLE_TIMER_H
+#define IMU_SAMPLE_TIMER_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// Build hôte : les interruptions sont simulées en appelant onDataReady() avec de faux instants
+#include <stdint.h>
+#include <stddef.h>
+#endif
+
+const uint8_t IMU_TIMESTAMP_QUEUE_SIZE = 32;   // Puissance de 2
+
+// Horodatage des échantillons du gyroscope par l'interruption "données prêtes".
+// Producteur unique (interruption) / consommateur unique (update()) : sans verrou,
+// chaque index n'est écrit que d'un seul côté.
+class ImuSampleTimer {
+private:
+    volatile unsigned long timestamps[IMU_TIMESTAMP_QUEUE_SIZE];
+    volatile uint8_t head;       // Écrit par l'interruption
+    volatile uint8_t tail;       // Écrit par le contexte principal
+    volatile unsigned long dropped;
+    
+    unsigned long lastTimestamp;
+    bool hasLast;
+    
+public:
+    ImuSampleTimer();
+    
+    // Appelé depuis l'interruption (ou par le banc de test sur l'hôte)
+    void onDataReady(unsigned long timestampUs);
+    
+    uint8_t pending() const;
+    
+    // Intervalle (s) entre l'échantillon suivant et le précédent, mesuré sur micros() ;
+    // false si aucun horodatage n'est disponible
+    bool nextInterval(float& dt, float nominalDt);
+    
+    // Vide la file (FIFO du capteur réinitialisée) ; la référence de temps repart à zéro
+    void clear();
+    unsigned long getDropped() const { return dropped; }
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef LINE_ASSEMBLER_H
+#define LINE_ASSEMBLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Reconstitue des lignes octet par octet dans un tampon fixe, sans jamais attendre.
+// Une ligne trop longue est ignorée jusqu'à sa fin ; '\r' est ignoré.
+template <size_t N>
+class LineAssembler {
+private:
+    char buffer[N];
+    size_t length;
+    bool overflow;
+    bool ready;
+    unsigned long overflowCount;
+    
+public:
+    LineAssembler() : length(0), overflow(false), ready(false), overflowCount(0) {
+        buffer[0] = '\0';
+    }
+    
+    // Ajoute un octet ; retourne true quand une ligne complète est disponible
+    bool feed(char c) {
+        if (ready) reset();
+        
+        if (c == '\r') return false;
+        
+        if (c == '\n') {
+            if (overflow) {
+                overflow = false;
+                length = 0;
+                return false;
+            }
+            // Les lignes vides sont rendues (fin des en-têtes HTTP)
+            buffer[length] = '\0';
+            ready = true;
+            return true;
+        }
+        
+        if (overflow) return false;
+        
+        if (length >= N - 1) {
+            overflow = true;
+            overflowCount++;
+            return false;
+        }
+        
+        buffer[length++] = c;
+        return false;
+    }
+    
+    // Ligne terminée, modifiable sur place jusqu'au prochain feed()
+    char* line() { return buffer; }
+    size_t lineLength() const { return length; }
+    bool isPartial() const { return length > 0 && !ready; }
+    unsigned long getOverflowCount() const { return overflowCount; }
+    
+    void reset() {
+        length = 0;
+        ready = false;
+        buffer[0] = '\0';
+    }
+};
+
+#endif
@@ -0,0 +1,57 @@
+#include "local_frame.h"
+#include <math.h>
+
+static const double EARTH_RADIUS = 6371000.0;   // Même rayon que GPSHandler
+static const double DEG_TO_RAD_D = 3.14159265358979323846 / 180.0;
+static const float PI_F = 3.14159265f;
+static const float HALF_PI_F = 1.57079633f;
+
+LocalFrame::LocalFrame()
+    : originLat(0.0), originLng(0.0), metersPerDegLat(0.0f), metersPerDegLng(0.0f) {
+}
+
+void LocalFrame::setOrigin(double lat, double lng) {
+    originLat = lat;
+    originLng = lng;
+    // Seuls calculs trigonométriques, une fois par cible
+    metersPerDegLat = (float)(EARTH_RADIUS * DEG_TO_RAD_D);
+    metersPerDegLng = (float)(EARTH_RADIUS * DEG_TO_RAD_D * cos(lat * DEG_TO_RAD_D));
+}
+
+void LocalFrame::toLocal(double lat, double lng, float& east, float& north) const {
+    // Différence en double (coordonnées absolues à 1e-7°), le reste en flottant
+    east = (float)(lng - originLng) * metersPerDegLng;
+    north = (float)(lat - originLat) * metersPerDegLat;
+}
+
+float LocalFrame::distanceToOrigin(double lat, double lng) const {
+    float east, north;
+    toLocal(lat, lng, east, north);
+    return sqrtf(east * east + north * north);
+}
+
+float LocalFrame::bearingToOrigin(double lat, double lng) const {
+    float east, north;
+    toLocal(lat, lng, east, north);
+    // Vecteur position -> origine ; cap mesuré depuis le Nord, sens horaire
+    float bearing = fastAtan2(-east, -north) * (180.0f / PI_F);
+    if (bearing < 0.0f) bearing += 360.0f;
+    return bearing;
+}
+
+float LocalFrame::fastAtan2(float y, float x) {
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    if (ax == 0.0f && ay == 0.0f) return 0.0f;
+    
+    // Réduction à [0, 1] puis polynôme impair de degré 9
+    bool swap = ay > ax;
+    float z = swap ? ax / ay : ay / ax;
+    float z2 = z * z;
+    float angle = z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f + z2 * (-0.0851330f + z2 * 0.0208351f))));
+    
+    if (swap) angle = HALF_PI_F - angle;
+    if (x < 0.0f) angle = PI_F - angle;
+    if (y < 0.0f) angle = -angle;
+    return angle;
+}
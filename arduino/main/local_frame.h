@@ -0,0 +1,33 @@
+#ifndef LOCAL_FRAME_H
+#define LOCAL_FRAME_H
+
+// Plan tangent local (Est, Nord) centré sur une origine fixe, sur la même sphère
+// (R = 6371 km) que GPSHandler::calculateDistance().
+// Après setOrigin(), distance et cap ne coûtent qu'une soustraction en double par axe,
+// des multiplications flottantes, un sqrtf et fastAtan2().
+//
+// Écart avec haversine/calculateBearing (test/test_local_frame.cpp : 5 m à 2 km, latitudes ≤ 60°) :
+// distance < 0,02 %, cap < 0,02°, erreur propre de fastAtan2() comprise.
+class LocalFrame {
+private:
+    double originLat, originLng;
+    float metersPerDegLat;
+    float metersPerDegLng;   // Réduit par cos(latitude de l'origine)
+    
+public:
+    LocalFrame();
+    
+    void setOrigin(double lat, double lng);
+    
+    // Position dans le plan local (m)
+    void toLocal(double lat, double lng, float& east, float& north) const;
+    
+    // Distance (m) et cap (0-360°, 0 = Nord) d'un point vers l'origine
+    float distanceToOrigin(double lat, double lng) const;
+    float bearingToOrigin(double lat, double lng) const;
+    
+    // atan2 polynomial (Abramowitz & Stegun 4.4.49), erreur ≤ 1,2e-5 rad en flottant
+    static float fastAtan2(float y, float x);
+};
+
+#endif
@@ -0,0 +1,155 @@
+#include "logger.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+Logger logger;
+
+// Marqueur d'enregistrement binaire (jamais présent dans un texte)
+static const uint8_t EVENT_MARKER = 0x01;
+static const uint8_t EVENT_RECORD_SIZE = 7;  // marqueur, module, événement, valeur int32
+
+static const char* const MODULE_NAMES[LOG_MODULE_COUNT] = {
+    "robot", "distance", "servo", "moteur", "gps", "mpu", "nav", "wifi"
+};
+
+static const char* const EVENT_NAMES[EVT_COUNT] = {
+    "distance_mm",
+    "obstacle",
+    "arret_securite",
+    "distance_cible_dm",
+    "cap_cible_ddeg",
+    "angle_robot_ddeg",
+    "erreur_angle_ddeg",
+    "avance",
+    "gps_seul",
+    "arrivee",
+    "point_passage",
+    "braquage_pwm"
+};
+
+Logger::Logger()
+    : head(0), tail(0), dropped(0), stagingLength(0), stagingPos(0) {
+}
+
+void Logger::registerTasks(TaskScheduler& scheduler) {
+    scheduler.addTask("log", TASK_PERIOD_LOG, drainTask, this);
+}
+
+void Logger::drainTask(void* context) {
+    static_cast<Logger*>(context)->drain();
+}
+
+size_t Logger::freeSpace() const {
+    return (tail + LOG_BUFFER_SIZE - head - 1) % LOG_BUFFER_SIZE;
+}
+
+void Logger::pushByte(uint8_t value) {
+    buffer[head] = value;
+    head = (head + 1) % LOG_BUFFER_SIZE;
+}
+
+uint8_t Logger::popByte() {
+    uint8_t value = buffer[tail];
+    tail = (tail + 1) % LOG_BUFFER_SIZE;
+    return value;
+}
+
+void Logger::write(LogModule module, const char* text) {
+    const char* name = MODULE_NAMES[module];
+    size_t nameLength = strlen(name);
+    size_t textLength = strlen(text);
+    
+    // Message entier ou rien : "[module] texte\n"
+    if (nameLength + textLength + 4 > freeSpace()) {
+        dropped++;
+        return;
+    }
+    
+    pushByte('[');
+    for (size_t i = 0; i < nameLength; i++) pushByte(name[i]);
+    pushByte(']');
+    pushByte(' ');
+    for (size_t i = 0; i < textLength; i++) {
+        if ((uint8_t)text[i] != EVENT_MARKER) pushByte(text[i]);
+    }
+    pushByte('\n');
+}
+
+void Logger::format(LogModule module, const char* format, ...) {
+    char line[96];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    write(module, line);
+}
+
+void Logger::event(LogModule module, LogEvent event, int32_t value) {
+    if (freeSpace() < EVENT_RECORD_SIZE) {
+        dropped++;
+        return;
+    }
+    
+    pushByte(EVENT_MARKER);
+    pushByte(module);
+    pushByte(event);
+    pushByte(value & 0xFF);
+    pushByte((value >> 8) & 0xFF);
+    pushByte((value >> 16) & 0xFF);
+    pushByte((value >> 24) & 0xFF);
+}
+
+bool Logger::decodeEvent() {
+    uint8_t module = popByte();
+    uint8_t event = popByte();
+    uint32_t raw = popByte();
+    raw |= (uint32_t)popByte() << 8;
+    raw |= (uint32_t)popByte() << 16;
+    raw |= (uint32_t)popByte() << 24;
+    
+    if (module >= LOG_MODULE_COUNT || event >= EVT_COUNT) return false;
+    
+    int length = snprintf(staging, sizeof(staging), "[%s] %s=%ld\n",
+                          MODULE_NAMES[module], EVENT_NAMES[event], (long)(int32_t)raw);
+    if (length <= 0) return false;
+    
+    stagingLength = min((size_t)length, sizeof(staging) - 1);
+    stagingPos = 0;
+    return true;
+}
+
+void Logger::drain() {
+    int room = Serial.availableForWrite();
+    
+    while (room > 0) {
+        // Fin d'un événement décodé en attente
+        if (stagingPos < stagingLength) {
+            size_t chunk = min((size_t)room, (size_t)(stagingLength - stagingPos));
+            Serial.write((const uint8_t*)staging + stagingPos, chunk);
+            stagingPos += chunk;
+            room -= chunk;
+            continue;
+        }
+        
+        if (head == tail) break;
+        
+        if (buffer[tail] == EVENT_MARKER) {
+            popByte();
+            decodeEvent();
+            continue;
+        }
+        
+        // Texte contigu jusqu'au prochain marqueur ou à la fin du tampon circulaire
+        size_t end = (head > tail) ? head : LOG_BUFFER_SIZE;
+        size_t chunk = 0;
+        while (tail + chunk < end && chunk < (size_t)room && buffer[tail + chunk] != EVENT_MARKER) chunk++;
+        
+        Serial.write(buffer + tail, chunk);
+        tail = (tail + chunk) % LOG_BUFFER_SIZE;
+        room -= chunk;
+    }
+}
+
+unsigned long Logger::getDroppedCount() const {
+    return dropped;
+}
@@ -0,0 +1,109 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "task_scheduler.h"
+
+enum LogLevel {
+    LOG_LEVEL_NONE = 0,
+    LOG_LEVEL_ERROR = 1,
+    LOG_LEVEL_WARN = 2,
+    LOG_LEVEL_INFO = 3,
+    LOG_LEVEL_DEBUG = 4
+};
+
+enum LogModule {
+    LOG_ROBOT,
+    LOG_DISTANCE,
+    LOG_SERVO,
+    LOG_MOTOR,
+    LOG_GPS,
+    LOG_MPU,
+    LOG_NAV,
+    LOG_WIFI,
+    LOG_MODULE_COUNT
+};
+
+// Niveau maximal par module (plafonné par LOG_LEVEL)
+constexpr uint8_t LOG_MODULE_LEVELS[LOG_MODULE_COUNT] = {
+    LOG_LEVEL_INFO,   // robot
+    LOG_LEVEL_INFO,   // distance
+    LOG_LEVEL_INFO,   // servo
+    LOG_LEVEL_INFO,   // moteurs
+    LOG_LEVEL_INFO,   // gps
+    LOG_LEVEL_INFO,   // mpu
+    LOG_LEVEL_DEBUG,  // navigation
+    LOG_LEVEL_INFO    // wifi
+};
+
+// Événements du chemin critique : codés en binaire, formatés seulement à la vidange
+enum LogEvent {
+    EVT_DISTANCE_MM,
+    EVT_OBSTACLE,
+    EVT_SAFETY_STOP,
+    EVT_NAV_DISTANCE_DM,
+    EVT_NAV_BEARING_DDEG,
+    EVT_NAV_ANGLE_DDEG,
+    EVT_NAV_ERROR_DDEG,
+    EVT_NAV_FORWARD,
+    EVT_NAV_GPS_ONLY,
+    EVT_NAV_ARRIVED,
+    EVT_NAV_WAYPOINT,
+    EVT_NAV_STEER_PWM,
+    EVT_COUNT
+};
+
+constexpr bool logEnabled(LogModule module, LogLevel level) {
+    return level != LOG_LEVEL_NONE && level <= LOG_LEVEL && level <= LOG_MODULE_LEVELS[module];
+}
+
+// Journal tamponné en RAM, vidé en tâche de fond sans jamais bloquer sur Serial
+class Logger {
+private:
+    uint8_t buffer[LOG_BUFFER_SIZE];
+    size_t head;
+    size_t tail;
+    unsigned long dropped;
+    
+    // Ligne en cours d'émission (événement décodé)
+    char staging[48];
+    uint8_t stagingLength;
+    uint8_t stagingPos;
+    
+    size_t freeSpace() const;
+    void pushByte(uint8_t value);
+    uint8_t popByte();
+    bool decodeEvent();
+    static void drainTask(void* context);
+    
+public:
+    Logger();
+    void registerTasks(TaskScheduler& scheduler);
+    
+    void write(LogModule module, const char* text);
+    void format(LogModule module, const char* format, ...);
+    void event(LogModule module, LogEvent event, int32_t value);
+    void drain();
+    unsigned long getDroppedCount() const;
+};
+
+extern Logger logger;
+
+// Points d'entrée : supprimés à la compilation si le niveau est filtré
+template <LogModule M, LogLevel L, typename... Args>
+inline void logFormat(const char* format, Args... args) {
+    if (logEnabled(M, L)) logger.format(M, format, args...);
+}
+
+template <LogModule M, LogLevel L>
+inline void logText(const char* text) {
+    if (logEnabled(M, L)) logger.write(M, text);
+}
+
+template <LogModule M, LogLevel L>
+inline void logEvent(LogEvent event, int32_t value = 0) {
+    if (logEnabled(M, L)) logger.event(M, event, value);
+}
+
+#endif
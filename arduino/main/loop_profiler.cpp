@@ -0,0 +1,136 @@
+#include "loop_profiler.h"
+#include <stdio.h>
+
+static const char* const SECTION_NAMES[PROFILE_SECTION_COUNT] = {
+    "loop", "gyro", "gps", "ultrasonic", "servo", "navigation", "wifi", "http"
+};
+
+LoopProfiler::LoopProfiler() {
+    reset();
+}
+
+void LoopProfiler::reset() {
+    for (uint8_t i = 0; i < PROFILE_SECTION_COUNT; i++) {
+        ProfileStats& stats = sections[i];
+        stats.count = 0;
+        stats.minUs = 0xFFFFFFFF;
+        stats.maxUs = 0;
+        stats.totalUs = 0;
+        for (uint8_t b = 0; b < PROFILE_HISTOGRAM_BINS; b++) stats.histogram[b] = 0;
+    }
+    windowStart = millis();
+}
+
+uint8_t LoopProfiler::binForDuration(uint32_t durationUs) {
+    if (durationUs < 2) return 0;
+    
+    // Position du bit de poids fort, puis demi-octave selon le bit suivant
+    uint8_t msb = 31;
+    while (!(durationUs & (1UL << msb))) msb--;
+    uint8_t half = (durationUs >> (msb - 1)) & 1;
+    
+    uint8_t bin = msb * 2 + half;
+    return bin < PROFILE_HISTOGRAM_BINS ? bin : PROFILE_HISTOGRAM_BINS - 1;
+}
+
+uint32_t LoopProfiler::binUpperBound(uint8_t bin) {
+    if (bin < 2) return 1;
+    uint8_t msb = bin / 2;
+    uint32_t base = 1UL << msb;
+    return (bin & 1) ? (base << 1) - 1 : base + (base >> 1) - 1;
+}
+
+void LoopProfiler::record(ProfileSection section, uint32_t durationUs) {
+    ProfileStats& stats = sections[section];
+    
+    stats.count++;
+    stats.totalUs += durationUs;
+    if (durationUs < stats.minUs) stats.minUs = durationUs;
+    if (durationUs > stats.maxUs) stats.maxUs = durationUs;
+    
+    stats.histogram[binForDuration(durationUs)]++;
+}
+
+const char* LoopProfiler::getSectionName(ProfileSection section) {
+    return SECTION_NAMES[section];
+}
+
+const ProfileStats& LoopProfiler::getStats(ProfileSection section) const {
+    return sections[section];
+}
+
+uint32_t LoopProfiler::getAverage(ProfileSection section) const {
+    const ProfileStats& stats = sections[section];
+    return stats.count ? (uint32_t)(stats.totalUs / stats.count) : 0;
+}
+
+uint32_t LoopProfiler::getPercentile(ProfileSection section, uint8_t percent) const {
+    const ProfileStats& stats = sections[section];
+    if (stats.count == 0) return 0;
+    
+    // Borne haute de la classe contenant le percentile, plafonnée au maximum observé
+    uint32_t threshold = (uint32_t)(((uint64_t)stats.count * percent + 99) / 100);
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < PROFILE_HISTOGRAM_BINS; b++) {
+        seen += stats.histogram[b];
+        if (seen >= threshold) {
+            uint32_t bound = binUpperBound(b);
+            return bound < stats.maxUs ? bound : stats.maxUs;
+        }
+    }
+    return stats.maxUs;
+}
+
+uint32_t LoopProfiler::getFrequency(ProfileSection section) const {
+    unsigned long elapsed = millis() - windowStart;
+    if (elapsed == 0) return 0;
+    return (uint32_t)((uint64_t)sections[section].count * 1000ULL / elapsed);
+}
+
+size_t LoopProfiler::writeJson(char* buffer, size_t size) const {
+    size_t len = 0;
+    int written = snprintf(buffer, size, "{\"window_ms\":%lu",
+                           (unsigned long)(millis() - windowStart));
+    if (written < 0 || (size_t)written >= size) return 0;
+    len = written;
+    
+    for (uint8_t i = 0; i < PROFILE_SECTION_COUNT; i++) {
+        ProfileSection section = (ProfileSection)i;
+        const ProfileStats& stats = sections[i];
+        
+        written = snprintf(buffer + len, size - len,
+                           ",\"%s\":{\"n\":%lu,\"hz\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"p99\":%lu}",
+                           SECTION_NAMES[i],
+                           (unsigned long)stats.count,
+                           (unsigned long)getFrequency(section),
+                           (unsigned long)(stats.count ? stats.minUs : 0),
+                           (unsigned long)getAverage(section),
+                           (unsigned long)stats.maxUs,
+                           (unsigned long)getPercentile(section, 99));
+        if (written < 0 || (size_t)written >= size - len) return 0;
+        len += written;
+    }
+    
+    if (len + 2 > size) return 0;
+    buffer[len++] = '}';
+    buffer[len] = '\0';
+    return len;
+}
+
+#ifdef ARDUINO
+void LoopProfiler::printReport() const {
+    Serial.println("=== PROFIL (µs) ===");
+    for (uint8_t i = 0; i < PROFILE_SECTION_COUNT; i++) {
+        ProfileSection section = (ProfileSection)i;
+        const ProfileStats& stats = sections[i];
+        Serial.print(SECTION_NAMES[i]);
+        Serial.print(" | n: "); Serial.print(stats.count);
+        Serial.print(" | "); Serial.print(getFrequency(section)); Serial.print("Hz");
+        Serial.print(" | min: "); Serial.print(stats.count ? stats.minUs : 0);
+        Serial.print(" | moy: "); Serial.print(getAverage(section));
+        Serial.print(" | max: "); Serial.print(stats.maxUs);
+        Serial.print(" | p99: "); Serial.println(getPercentile(section, 99));
+    }
+    Serial.println("===================");
+}
+#endif
@@ -0,0 +1,77 @@
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// Build hôte : l'horloge est fournie par le banc de test (fausses micros() et millis())
+#include <stdint.h>
+#include <stddef.h>
+unsigned long micros();
+unsigned long millis();
+#endif
+
+// Sous-systèmes instrumentés
+enum ProfileSection {
+    PROFILE_LOOP,
+    PROFILE_GYRO,
+    PROFILE_GPS,
+    PROFILE_ULTRASONIC,
+    PROFILE_SERVO,
+    PROFILE_NAVIGATION,
+    PROFILE_WIFI,
+    PROFILE_HTTP_REQUEST,   // Latence d'une requête HTTP, de la ligne de requête à la réponse
+    PROFILE_SECTION_COUNT
+};
+
+// Histogramme logarithmique : 2 classes par octave, de 1 µs à ~1 s
+const uint8_t PROFILE_HISTOGRAM_BINS = 40;
+
+struct ProfileStats {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;   // La section "loop" cumule tout le temps : 32 bits débordent en 71 min
+    uint32_t histogram[PROFILE_HISTOGRAM_BINS];
+};
+
+class LoopProfiler {
+private:
+    ProfileStats sections[PROFILE_SECTION_COUNT];
+    unsigned long windowStart;   // ms : micros() déborde en 71 min
+    
+    static uint8_t binForDuration(uint32_t durationUs);
+    static uint32_t binUpperBound(uint8_t bin);
+    
+public:
+    LoopProfiler();
+    void record(ProfileSection section, uint32_t durationUs);
+    void reset();
+    
+    static const char* getSectionName(ProfileSection section);
+    const ProfileStats& getStats(ProfileSection section) const;
+    uint32_t getAverage(ProfileSection section) const;
+    uint32_t getPercentile(ProfileSection section, uint8_t percent) const;
+    uint32_t getFrequency(ProfileSection section) const;  // Appels par seconde
+    
+    // Sérialise toutes les sections en JSON compact, retourne la longueur écrite
+    size_t writeJson(char* buffer, size_t size) const;
+#ifdef ARDUINO
+    void printReport() const;
+#endif
+};
+
+// Mesure la durée du bloc englobant
+class ProfileScope {
+private:
+    LoopProfiler& profiler;
+    ProfileSection section;
+    unsigned long start;
+    
+public:
+    ProfileScope(LoopProfiler& loopProfiler, ProfileSection profileSection)
+        : profiler(loopProfiler), section(profileSection), start(micros()) {}
+    ~ProfileScope() { profiler.record(section, micros() - start); }
+};
+
+#endif
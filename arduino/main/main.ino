@@ -2,10 +2,15 @@
 #include "config.h"
 #include "robot_controller.h"
 #include "wifi_handler.h"
+#include "udp_control.h"
+#include "task_scheduler.h"
+#include "logger.h"
 
 // Instances globales
 RobotController robot;
 WiFiHandler wifiHandler(&robot);
+UdpControl udpControl(&robot);
+TaskScheduler scheduler;
 
 void setup() {
     // Initialisation du robot complet
@@ -13,17 +18,19 @@ void setup() {
     
     // Initialisation du WiFi
     wifiHandler.init();
+    udpControl.init();
+    
+    // Enregistrement des tâches périodiques (capteurs, sécurité, navigation, WiFi, série)
+    robot.registerTasks(scheduler);
+    wifiHandler.registerTasks(scheduler);
+    udpControl.registerTasks(scheduler);
+    logger.registerTasks(scheduler);
     
     Serial.println("✅ Système complet initialisé !");
 }
 
 void loop() {
-    // Mise à jour du robot (capteurs, sécurité, navigation, timeouts)
-    robot.update();
-    
-    // Gestion des clients WiFi
-    wifiHandler.handleClients();
-    
-    // Gestion des commandes série
-    robot.handleSerialCommand();
+    // Exécution des tâches arrivées à échéance
+    ProfileScope scope(robot.getProfiler(), PROFILE_LOOP);
+    scheduler.run();
 }
\ No newline at end of file
@@ -0,0 +1,14 @@
+#include "mission.h"
+
+Mission::Mission() : count(0) {
+}
+
+void Mission::clear() {
+    count = 0;
+}
+
+bool Mission::add(const Waypoint& waypoint) {
+    if (isFull()) return false;
+    waypoints[count++] = waypoint;
+    return true;
+}
@@ -0,0 +1,36 @@
+#ifndef MISSION_H
+#define MISSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Point de passage : vitesse et rayon d'arrivée propres au tronçon qui y mène.
+// Coordonnées en micro-degrés (0,11 m) : 16 octets par point au lieu de 24.
+struct Waypoint {
+    int32_t latE6, lngE6;
+    float speed;           // m/s
+    float arrivalRadius;   // m
+    
+    double latitude() const { return latE6 / 1e6; }
+    double longitude() const { return lngE6 / 1e6; }
+};
+
+// Liste ordonnée des points de passage d'une mission
+class Mission {
+private:
+    Waypoint waypoints[MISSION_MAX_WAYPOINTS];
+    uint8_t count;
+    
+public:
+    Mission();
+    void clear();
+    bool add(const Waypoint& waypoint);   // false si la mission est pleine
+    
+    uint8_t size() const { return count; }
+    bool isEmpty() const { return count == 0; }
+    bool isFull() const { return count >= MISSION_MAX_WAYPOINTS; }
+    const Waypoint& get(uint8_t index) const { return waypoints[index]; }
+};
+
+#endif
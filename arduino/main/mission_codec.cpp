@@ -0,0 +1,116 @@
+#include "mission_codec.h"
+#include <math.h>
+
+static uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static uint8_t writeVarint(uint32_t value, uint8_t* out) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (uint8_t)value;
+    return length;
+}
+
+static uint8_t quantize(float value, float scale) {
+    long quantized = lroundf(value * scale);
+    if (quantized < 1) return 1;
+    if (quantized > 255) return 255;
+    return (uint8_t)quantized;
+}
+
+MissionEncoder::MissionEncoder() {
+    reset();
+}
+
+void MissionEncoder::reset() {
+    lastLat = 0;
+    lastLng = 0;
+}
+
+uint8_t MissionEncoder::encode(const Waypoint& waypoint, uint8_t* out) {
+    uint8_t length = writeVarint(zigzag(waypoint.latE6 - lastLat), out);
+    length += writeVarint(zigzag(waypoint.lngE6 - lastLng), out + length);
+    out[length++] = quantize(waypoint.speed, 100.0f);          // cm/s
+    out[length++] = quantize(waypoint.arrivalRadius, 10.0f);   // dm
+    
+    lastLat = waypoint.latE6;
+    lastLng = waypoint.lngE6;
+    return length;
+}
+
+MissionDecoder::MissionDecoder() {
+    reset();
+}
+
+void MissionDecoder::reset() {
+    lastLat = 0;
+    lastLng = 0;
+    field = 0;
+    value = 0;
+    shift = 0;
+    error = false;
+}
+
+bool MissionDecoder::push(uint8_t byte, Waypoint& waypoint) {
+    if (error) return false;
+    
+    if (field < 2) {
+        // Varint : 7 bits par octet, bit de poids fort = suite
+        if (shift > 28) {
+            error = true;
+            return false;
+        }
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (byte & 0x80) {
+            shift += 7;
+            return false;
+        }
+        
+        if (field == 0) {
+            lastLat += unzigzag(value);
+            current.latE6 = lastLat;
+        } else {
+            lastLng += unzigzag(value);
+            current.lngE6 = lastLng;
+        }
+        value = 0;
+        shift = 0;
+        field++;
+        return false;
+    }
+    
+    if (field == 2) {
+        current.speed = byte / 100.0f;
+        field = 3;
+        return false;
+    }
+    
+    current.arrivalRadius = byte / 10.0f;
+    field = 0;
+    if (current.latE6 < -90000000L || current.latE6 > 90000000L ||
+        current.lngE6 < -180000000L || current.lngE6 > 180000000L || current.speed <= 0.0f || current.arrivalRadius <= 0.0f) {
+        error = true;
+        return false;
+    }
+    waypoint = current;
+    return true;
+}
+
+uint32_t missionCrc32(uint32_t crc, const uint8_t* data, size_t length) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,47 @@
+#ifndef MISSION_CODEC_H
+#define MISSION_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mission.h"
+
+// Encodage binaire compact d'une mission : pour chaque point, écarts de latitude
+// et de longitude (micro-degrés) au point précédent en varint zigzag, puis vitesse
+// (cm/s) et rayon d'arrivée (dm) sur un octet chacun. Un tronçon de 100 m tient
+// en 6 octets, contre 24 pour deux doubles et deux flottants.
+const uint8_t MISSION_MAX_ENCODED = 12;   // Pire cas par point (deux varints de 5 octets)
+
+class MissionEncoder {
+private:
+    int32_t lastLat, lastLng;
+    
+public:
+    MissionEncoder();
+    void reset();
+    // Retourne le nombre d'octets écrits dans out (MISSION_MAX_ENCODED au plus)
+    uint8_t encode(const Waypoint& waypoint, uint8_t* out);
+};
+
+// Décodage octet par octet, directement depuis la mémoire non volatile
+class MissionDecoder {
+private:
+    int32_t lastLat, lastLng;
+    Waypoint current;
+    uint8_t field;      // 0 latitude, 1 longitude, 2 vitesse, 3 rayon
+    uint32_t value;
+    uint8_t shift;
+    bool error;
+    
+public:
+    MissionDecoder();
+    void reset();
+    // true quand un point complet est disponible dans waypoint
+    bool push(uint8_t byte, Waypoint& waypoint);
+    bool hasError() const { return error; }
+    bool isAligned() const { return field == 0 && shift == 0; }   // Pas de point entamé
+};
+
+// CRC-32 (polynôme 0xEDB88320, compatible zlib) : crc32(crc32(0, a), b) == crc32(0, a + b)
+uint32_t missionCrc32(uint32_t crc, const uint8_t* data, size_t length);
+
+#endif
@@ -0,0 +1,132 @@
+#include "mission_store.h"
+#include "mission_codec.h"
+#include <EEPROM.h>
+
+static const uint32_t MISSION_RECORD_MAGIC = 0x314E534D;   // "MSN1"
+static const int MISSION_DATA_ADDR = MISSION_EEPROM_ADDR + sizeof(MissionRecordHeader);
+
+MissionStore::MissionStore() : headerValid(false) {
+    memset(&header, 0, sizeof(header));
+}
+
+uint16_t MissionStore::headerCheck(const MissionRecordHeader& record) {
+    return (uint16_t)missionCrc32(0, (const uint8_t*)&record, offsetof(MissionRecordHeader, check));
+}
+
+void MissionStore::init() {
+    EEPROM.get(MISSION_EEPROM_ADDR, header);
+    headerValid = header.magic == MISSION_RECORD_MAGIC && header.check == headerCheck(header) &&
+                  header.length <= MISSION_EEPROM_CAPACITY && header.received <= header.length;
+}
+
+void MissionStore::writeHeader() {
+    header.magic = MISSION_RECORD_MAGIC;
+    header.check = headerCheck(header);
+    EEPROM.put(MISSION_EEPROM_ADDR, header);
+    headerValid = true;
+}
+
+uint32_t MissionStore::storedCrc() const {
+    uint32_t crc = 0;
+    for (uint16_t i = 0; i < header.length; i++) {
+        uint8_t byte = EEPROM.read(MISSION_DATA_ADDR + i);
+        crc = missionCrc32(crc, &byte, 1);
+    }
+    return crc;
+}
+
+bool MissionStore::begin(uint16_t count, uint16_t length, uint32_t crc) {
+    if (count == 0 || count > MISSION_MAX_WAYPOINTS || length > MISSION_EEPROM_CAPACITY) return false;
+    
+    // Même mission déjà entamée (ou complète) : on reprend là où l'envoi s'était arrêté
+    if (headerValid && header.count == count && header.length == length && header.crc == crc) return true;
+    
+    header.count = count;
+    header.length = length;
+    header.crc = crc;
+    header.received = 0;
+    writeHeader();
+    return true;
+}
+
+MissionChunkResult MissionStore::writeChunk(uint16_t offset, const uint8_t* data, uint8_t length, uint32_t chunkCrc) {
+    // Morceaux dans l'ordre, renvoi d'un morceau déjà écrit toléré (accusé perdu)
+    if (!headerValid || length == 0 || offset > header.received ||
+        (uint32_t)offset + length > header.length || missionCrc32(0, data, length) != chunkCrc) {
+        return MISSION_CHUNK_REJECTED;
+    }
+    
+    for (uint8_t i = 0; i < length; i++) {
+        EEPROM.update(MISSION_DATA_ADDR + offset + i, data[i]);
+    }
+    if (offset + length > header.received) {
+        header.received = offset + length;
+        writeHeader();
+    }
+    if (header.received < header.length) return MISSION_CHUNK_OK;
+    
+    // Données complètes : relecture et vérification du CRC global
+    if (storedCrc() != header.crc) {
+        header.received = 0;
+        writeHeader();
+        return MISSION_CHUNK_CORRUPT;
+    }
+    return MISSION_CHUNK_COMPLETE;
+}
+
+bool MissionStore::save(const Mission& mission) {
+    if (mission.isEmpty()) return false;
+    
+    // Premier passage : longueur et CRC seulement, la mission mémorisée reste intacte si trop grande
+    MissionEncoder encoder;
+    uint8_t buffer[MISSION_MAX_ENCODED];
+    uint16_t length = 0;
+    uint32_t crc = 0;
+    for (uint8_t i = 0; i < mission.size(); i++) {
+        uint8_t encoded = encoder.encode(mission.get(i), buffer);
+        if (length + encoded > MISSION_EEPROM_CAPACITY) return false;
+        crc = missionCrc32(crc, buffer, encoded);
+        length += encoded;
+    }
+    
+    // En-tête marqué incomplet avant d'écrire les données : une coupure en cours
+    // d'écriture ne laisse jamais un en-tête valide devant des données mélangées
+    header.count = mission.size();
+    header.length = length;
+    header.crc = crc;
+    header.received = 0;
+    writeHeader();
+    
+    // Second passage : écriture directe en EEPROM
+    encoder.reset();
+    int address = MISSION_DATA_ADDR;
+    for (uint8_t i = 0; i < mission.size(); i++) {
+        uint8_t encoded = encoder.encode(mission.get(i), buffer);
+        for (uint8_t b = 0; b < encoded; b++) {
+            EEPROM.update(address++, buffer[b]);
+        }
+    }
+    
+    header.received = length;
+    writeHeader();
+    return true;
+}
+
+bool MissionStore::load(Mission& mission) const {
+    if (!isComplete() || header.count > MISSION_MAX_WAYPOINTS) return false;
+    
+    // CRC vérifié avant de toucher à la mission courante, puis décodage direct
+    if (storedCrc() != header.crc) return false;
+    
+    mission.clear();
+    MissionDecoder decoder;
+    Waypoint waypoint;
+    for (uint16_t i = 0; i < header.length; i++) {
+        if (decoder.push(EEPROM.read(MISSION_DATA_ADDR + i), waypoint) && !mission.add(waypoint)) break;
+    }
+    if (decoder.hasError() || !decoder.isAligned() || mission.size() != header.count) {
+        mission.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,56 @@
+#ifndef MISSION_STORE_H
+#define MISSION_STORE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "mission.h"
+
+// En-tête de la mission en mémoire non volatile (16 octets), données encodées à la suite
+struct MissionRecordHeader {
+    uint32_t magic;
+    uint16_t count;      // Points
+    uint16_t length;     // Octets de données
+    uint32_t crc;        // CRC-32 des données (missionCrc32)
+    uint16_t received;   // Octets reçus : égal à length quand la mission est complète
+    uint16_t check;      // Contrôle de l'en-tête
+};
+
+enum MissionChunkResult {
+    MISSION_CHUNK_OK,
+    MISSION_CHUNK_COMPLETE,   // Dernier morceau reçu, CRC global vérifié
+    MISSION_CHUNK_REJECTED,   // CRC du morceau, position ou taille invalide : à renvoyer
+    MISSION_CHUNK_CORRUPT     // CRC global faux : envoi à recommencer
+};
+
+// Mission mémorisée en EEPROM au format de mission_codec.h.
+// L'envoi se fait par morceaux vérifiés (CRC-32) ; l'en-tête mémorise les octets
+// reçus, si bien qu'un envoi interrompu (coupure, redémarrage) reprend au dernier
+// morceau écrit. Au démarrage, la mission se relit octet par octet, sans tampon.
+class MissionStore {
+private:
+    MissionRecordHeader header;
+    bool headerValid;
+    
+    static uint16_t headerCheck(const MissionRecordHeader& record);
+    void writeHeader();
+    uint32_t storedCrc() const;
+    
+public:
+    MissionStore();
+    void init();
+    
+    // Début (ou reprise si même mission) d'un envoi ; false si trop grand
+    bool begin(uint16_t count, uint16_t length, uint32_t crc);
+    MissionChunkResult writeChunk(uint16_t offset, const uint8_t* data, uint8_t length, uint32_t chunkCrc);
+    
+    bool save(const Mission& mission);
+    bool load(Mission& mission) const;
+    
+    bool isComplete() const { return headerValid && header.received == header.length; }
+    bool isUploading() const { return headerValid && header.received < header.length; }
+    uint16_t getReceived() const { return headerValid ? header.received : 0; }
+    uint16_t getLength() const { return headerValid ? header.length : 0; }
+    uint16_t getCount() const { return headerValid ? header.count : 0; }
+};
+
+#endif
@@ -2,7 +2,7 @@
 
 MotorController::MotorController(int pwmA_pin, int pwmB_pin, int ain_pin, int bin_pin, int stby_pin) 
     : pwmA(pwmA_pin), pwmB(pwmB_pin), ain(ain_pin), bin(bin_pin), stby(stby_pin), 
-      rotationStartTime(0), isRotating(false) {
+      rotationStartTime(0), isRotating(false), commandedPwm(0), running(false) {
 }
 
 void MotorController::init() {
@@ -18,7 +18,9 @@ void MotorController::init() {
 }
 
 void MotorController::forward() {
+    commandedPwm = MOTOR_SPEED_NORMAL;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, HIGH);
     digitalWrite(bin, HIGH);
@@ -27,7 +29,9 @@ void MotorController::forward() {
 }
 
 void MotorController::backward() {
+    commandedPwm = -MOTOR_SPEED_NORMAL;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, LOW);
     digitalWrite(bin, LOW);
@@ -36,8 +40,10 @@ void MotorController::backward() {
 }
 
 void MotorController::rotateLeft90() {
+    commandedPwm = 0;
     isRotating = true;
     rotationStartTime = millis();
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, HIGH);
     digitalWrite(bin, LOW);
@@ -46,8 +52,10 @@ void MotorController::rotateLeft90() {
 }
 
 void MotorController::rotateRight90() {
+    commandedPwm = 0;
     isRotating = true;
     rotationStartTime = millis();
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, LOW);
     digitalWrite(bin, HIGH);
@@ -56,7 +64,9 @@ void MotorController::rotateRight90() {
 }
 
 void MotorController::forwardRight() {
+    commandedPwm = (MOTOR_SPEED_CURVE + MOTOR_SPEED_NORMAL) / 2;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, HIGH);
     digitalWrite(bin, HIGH);
@@ -65,7 +75,9 @@ void MotorController::forwardRight() {
 }
 
 void MotorController::forwardLeft() {
+    commandedPwm = (MOTOR_SPEED_CURVE + MOTOR_SPEED_NORMAL) / 2;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, HIGH);
     digitalWrite(bin, HIGH);
@@ -74,7 +86,9 @@ void MotorController::forwardLeft() {
 }
 
 void MotorController::backwardRight() {
+    commandedPwm = -(MOTOR_SPEED_CURVE + MOTOR_SPEED_NORMAL) / 2;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, LOW);
     digitalWrite(bin, LOW);
@@ -83,7 +97,9 @@ void MotorController::backwardRight() {
 }
 
 void MotorController::backwardLeft() {
+    commandedPwm = -(MOTOR_SPEED_CURVE + MOTOR_SPEED_NORMAL) / 2;
     isRotating = false;
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, LOW);
     digitalWrite(bin, LOW);
@@ -92,9 +108,11 @@ void MotorController::backwardLeft() {
 }
 
 void MotorController::stop() {
+    commandedPwm = 0;
     analogWrite(pwmA, 0);
     analogWrite(pwmB, 0);
     digitalWrite(stby, LOW);
+    running = false;
 }
 
 void MotorController::checkRotationTimeout() {
@@ -108,6 +126,14 @@ bool MotorController::getIsRotating() const {
     return isRotating;
 }
 
+bool MotorController::isStopped() const {
+    return !running;
+}
+
+float MotorController::getCommandedSpeed() const {
+    return commandedPwm * MOTOR_PWM_TO_MPS;
+}
+
 // === NOUVELLES MÉTHODES POUR NAVIGATION GPS ===
 
 void MotorController::goForward() {
@@ -115,7 +141,9 @@ void MotorController::goForward() {
 }
 
 void MotorController::turnRight(int speed) {
+    commandedPwm = 0;
     isRotating = false; // Les rotations GPS ne sont pas limitées dans le temps
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, HIGH);   // Moteur A en avant
     digitalWrite(bin, LOW);    // Moteur B en arrière
@@ -124,7 +152,9 @@ void MotorController::turnRight(int speed) {
 }
 
 void MotorController::turnLeft(int speed) {
+    commandedPwm = 0;
     isRotating = false; // Les rotations GPS ne sont pas limitées dans le temps
+    running = true;
     digitalWrite(stby, HIGH);
     digitalWrite(ain, LOW);    // Moteur A en arrière
     digitalWrite(bin, HIGH);   // Moteur B en avant
@@ -140,22 +170,22 @@ void MotorController::turnLeft() {
     turnLeft(MIN_TURN_SPEED + 30);   // Vitesse par défaut
 }
 
-int MotorController::calculateTurnSpeed(double angle_error) {
-    // Calculer la vitesse en fonction de l'angle à tourner
-    double abs_error = abs(angle_error);
-    int speed;
-    
-    if (abs_error <= 8) {
-        speed = MIN_TURN_SPEED;
-    } else if (abs_error <= 20) {
-        speed = map(abs_error, 8, 20, MIN_TURN_SPEED, MIN_TURN_SPEED + 25);
-    } else if (abs_error <= 45) {
-        speed = map(abs_error, 20, 45, MIN_TURN_SPEED + 25, MIN_TURN_SPEED + 50);
-    } else {
-        speed = MAX_TURN_SPEED;
+void MotorController::drive(int leftPwm, int rightPwm) {
+    leftPwm = constrain(leftPwm, -MOTOR_MAX_PWM, MOTOR_MAX_PWM);
+    rightPwm = constrain(rightPwm, -MOTOR_MAX_PWM, MOTOR_MAX_PWM);
+    if (leftPwm == 0 && rightPwm == 0) {
+        stop();
+        return;
     }
     
-    return constrain(speed, MIN_TURN_SPEED, MAX_TURN_SPEED);
+    commandedPwm = (leftPwm + rightPwm) / 2;
+    isRotating = false;
+    running = true;
+    digitalWrite(stby, HIGH);
+    digitalWrite(ain, leftPwm >= 0 ? HIGH : LOW);
+    digitalWrite(bin, rightPwm >= 0 ? HIGH : LOW);
+    analogWrite(pwmA, abs(leftPwm));
+    analogWrite(pwmB, abs(rightPwm));
 }
 
 void MotorController::testMotors() {
@@ -9,6 +9,8 @@ private:
     int pwmA, pwmB, ain, bin, stby;
     unsigned long rotationStartTime;
     bool isRotating;
+    int commandedPwm;   // Consigne d'avance moyenne des deux roues (négative en arrière)
+    bool running;       // Au moins une roue alimentée
     
 public:
     MotorController(int pwmA_pin, int pwmB_pin, int ain_pin, int bin_pin, int stby_pin);
@@ -24,6 +26,8 @@ public:
     void stop();
     void checkRotationTimeout();
     bool getIsRotating() const;
+    float getCommandedSpeed() const;   // Consigne convertie en m/s (estimateur de pose)
+    bool isStopped() const;
     
     // Nouvelles méthodes pour navigation GPS
     void goForward();
@@ -31,7 +35,7 @@ public:
     void turnLeft(int speed);
     void turnRight(); // Version sans paramètre (vitesse par défaut)
     void turnLeft();  // Version sans paramètre (vitesse par défaut)
-    int calculateTurnSpeed(double angle_error);
+    void drive(int leftPwm, int rightPwm);   // PWM signé par roue (A gauche, B droite)
     void testMotors();
 };
 
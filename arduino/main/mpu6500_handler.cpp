@@ -1,7 +1,55 @@
 #include "mpu6500_handler.h"
+#include <EEPROM.h>
 
-MPU6500Handler::MPU6500Handler() 
-    : gyroOffset(0.0), robotAngle(0.0), lastGyroTime(0), gyroOK(false) {
+// Registres MPU-6500
+static const uint8_t REG_SMPLRT_DIV = 0x19;
+static const uint8_t REG_CONFIG = 0x1A;
+static const uint8_t REG_GYRO_CONFIG = 0x1B;
+static const uint8_t REG_FIFO_EN = 0x23;
+static const uint8_t REG_INT_PIN_CFG = 0x37;
+static const uint8_t REG_INT_ENABLE = 0x38;
+static const uint8_t REG_USER_CTRL = 0x6A;
+static const uint8_t REG_PWR_MGMT_1 = 0x6B;
+static const uint8_t REG_FIFO_COUNT_H = 0x72;
+static const uint8_t REG_FIFO_R_W = 0x74;
+
+static const uint8_t REG_TEMP_OUT_H = 0x41;
+
+static const uint8_t FIFO_EN_TEMP = 0x80;
+static const uint8_t FIFO_EN_GYRO_Z = 0x10;
+static const uint8_t USER_CTRL_FIFO_EN = 0x40;
+static const uint8_t USER_CTRL_FIFO_RST = 0x04;
+static const uint8_t INT_PIN_CFG_ANYRD_2CLEAR = 0x10;
+static const uint8_t INT_ENABLE_RAW_RDY = 0x01;
+static const uint16_t FIFO_SIZE = 512;
+static const uint8_t FIFO_SAMPLE_BYTES = 4;   // TEMP_OUT_H/L puis GYRO_ZOUT_H/L (ordre des registres)
+
+// Modèle de biais en mémoire non volatile
+static const uint32_t BIAS_RECORD_MAGIC = 0x47425431;  // "GBT1"
+
+struct GyroBiasRecord {
+    uint32_t magic;
+    float offset;
+    float slope;
+    uint32_t check;
+};
+
+static uint32_t biasRecordCheck(const GyroBiasRecord& record) {
+    uint32_t words[2];
+    memcpy(words, &record.offset, sizeof(float));
+    memcpy(words + 1, &record.slope, sizeof(float));
+    return record.magic ^ words[0] ^ (words[1] * 31u) ^ 0xA5A5A5A5u;
+}
+
+static const float SAMPLE_PERIOD = 1.0 / MPU_SAMPLE_RATE_HZ;
+
+MPU6500Handler* MPU6500Handler::interruptInstance = NULL;
+
+MPU6500Handler::MPU6500Handler(I2cBus& i2cBus) 
+    : bus(i2cBus), readState(MPU_READ_IDLE), fifoSamples(0), batchReady(false),
+      stationary(false), temperature(MPU_BIAS_REFERENCE_TEMP), tempSensitivity(333.87), tempOffset(21.0),
+      savedOffset(0.0), savedSlope(0.0), lastBiasSave(0), robotAngle(0.0), lastRate(0.0), lastDt(0.0), gyroOK(false), fifoOverflows(0),
+      interruptMode(false), lastSampleTime(0) {
 }
 
 void MPU6500Handler::init() {
@@ -24,17 +72,16 @@ void MPU6500Handler::init() {
             Serial.print("ID=0x"); Serial.print(who_am_i, HEX); Serial.print(" ");
             
             if (who_am_i == 0x70 || who_am_i == 0x68) {  // MPU-6500 ou MPU-6050
-                // Configuration gyroscope ±250°/s
-                Wire.beginTransmission(MPU6500_ADDR);
-                Wire.write(0x1B);
-                Wire.write(0x00);
-                Wire.endTransmission(true);
+                // Conversion de TEMP_OUT propre à chaque modèle
+                tempSensitivity = (who_am_i == 0x70) ? 333.87 : 340.0;
+                tempOffset = (who_am_i == 0x70) ? 21.0 : 36.53;
+                configureSampling();
                 
                 gyroOK = true;
-                lastGyroTime = millis();
+                // Pas de calibration bloquante : modèle de biais sauvegardé s'il existe,
+                // sinon estimé dès la première fenêtre immobile (robot posé au démarrage)
+                loadBiasModel();
                 Serial.println("✅ OK");
-                
-                calibrate();
             } else {
                 gyroOK = false;
                 Serial.println("❌ ID incorrect");
@@ -49,27 +96,206 @@ void MPU6500Handler::init() {
     }
 }
 
-void MPU6500Handler::update() {
-    if (!gyroOK) return;
+void MPU6500Handler::configureSampling() {
+    writeRegister(REG_PWR_MGMT_1, 0x01);                        // Horloge PLL du gyroscope
+    writeRegister(REG_CONFIG, MPU_DLPF_CFG);                    // Passe-bas, FIFO en écrasement
+    writeRegister(REG_SMPLRT_DIV, 1000 / MPU_SAMPLE_RATE_HZ - 1);
+    writeRegister(REG_GYRO_CONFIG, 0x00);                       // ±250°/s, DLPF actif
+    writeRegister(REG_FIFO_EN, FIFO_EN_TEMP | FIFO_EN_GYRO_Z);
+    
+    if (MPU_INTERRUPT_MODE) {
+        // Impulsion "données prêtes" à chaque échantillon, effacée par toute lecture
+        writeRegister(REG_INT_PIN_CFG, INT_PIN_CFG_ANYRD_2CLEAR);
+        writeRegister(REG_INT_ENABLE, INT_ENABLE_RAW_RDY);
+        if (!interruptMode) {
+            interruptInstance = this;
+            pinMode(MPU_INT_PIN, INPUT);
+            attachInterrupt(digitalPinToInterrupt(MPU_INT_PIN), dataReadyISR, RISING);
+            interruptMode = true;
+        }
+    }
+    resetFifo();
+}
+
+void MPU6500Handler::resetFifo() {
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_RST);
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_EN);
+    sampleTimer.clear();
+    lastSampleTime = millis();
+}
+
+void MPU6500Handler::queueFifoReset() {
+    // Même séquence que resetFifo(), par la file (tampons constants)
+    static const uint8_t fifoReset = USER_CTRL_FIFO_RST;
+    static const uint8_t fifoEnable = USER_CTRL_FIFO_EN;
+    bus.submitWrite(MPU6500_ADDR, REG_USER_CTRL, &fifoReset, 1);
+    bus.submitWrite(MPU6500_ADDR, REG_USER_CTRL, &fifoEnable, 1);
+    sampleTimer.clear();
+    lastSampleTime = millis();
+}
+
+void MPU6500Handler::dataReadyISR() {
+    if (interruptInstance) {
+        interruptInstance->sampleTimer.onDataReady(micros());
+    }
+}
+
+bool MPU6500Handler::update() {
+    if (!gyroOK) return false;
+    
+    // Lot lu et intégré par la file I2C depuis le dernier passage
+    if (batchReady) {
+        batchReady = false;
+        return true;
+    }
+    if (readState != MPU_READ_IDLE) return false;
+    
+    // Mode interruption : aucun accès au bus tant qu'aucun échantillon n'est signalé
+    if (interruptMode && sampleTimer.pending() == 0) {
+        if (millis() - lastSampleTime < MPU_INT_TIMEOUT) return false;
+        
+        detachInterrupt(digitalPinToInterrupt(MPU_INT_PIN));
+        interruptMode = false;
+        Serial.println("⚠️ MPU: pas d'interruption INT, lecture FIFO seule");
+    }
     
-    unsigned long now = millis();
-    float dt = (now - lastGyroTime) / 1000.0;  // Delta temps en secondes
+    // Nombre d'octets en FIFO, puis lecture groupée dans le rappel : jamais d'attente sur le bus
+    if (bus.submitRead(MPU6500_ADDR, REG_FIFO_COUNT_H, countBuffer, 2, fifoCountComplete, this)) {
+        readState = MPU_READ_COUNT;
+    }
+    return false;
+}
+
+bool MPU6500Handler::updateNow() {
+    bool updated = update();
+    while (!bus.isIdle()) bus.poll();
+    return update() || updated;
+}
+
+void MPU6500Handler::fifoCountComplete(void* context, const I2cTransaction& transaction, I2cStatus status) {
+    MPU6500Handler* mpu = static_cast<MPU6500Handler*>(context);
+    mpu->readState = MPU_READ_IDLE;
+    if (status != I2C_OK) return;
     
-    if (dt < (MIN_GYRO_INTERVAL / 1000.0)) return;  // Minimum entre lectures
+    uint16_t count = ((uint16_t)mpu->countBuffer[0] << 8) | mpu->countBuffer[1];
     
-    // Lire vitesse de rotation Z (°/s)
-    float rotation_speed = readGyroZ() - gyroOffset;
+    // FIFO pleine : des échantillons ont été écrasés, on repart proprement
+    if (count >= FIFO_SIZE) {
+        mpu->fifoOverflows++;
+        mpu->queueFifoReset();
+        return;
+    }
     
-    // Intégrer pour obtenir l'angle
-    robotAngle += rotation_speed * dt;
-    robotAngle = normalizeAngle(robotAngle);
+    uint16_t samples = count / FIFO_SAMPLE_BYTES;
+    if (samples == 0) return;
+    if (samples > MPU_FIFO_BURST_SAMPLES) samples = MPU_FIFO_BURST_SAMPLES;  // Le reste au passage suivant
     
-    lastGyroTime = now;
+    // Lecture groupée de tous les échantillons en une transaction
+    mpu->fifoSamples = samples;
+    if (mpu->bus.submitRead(MPU6500_ADDR, REG_FIFO_R_W, mpu->fifoBuffer, samples * FIFO_SAMPLE_BYTES,
+                            fifoDataComplete, mpu)) {
+        mpu->readState = MPU_READ_DATA;
+    }
+}
+
+void MPU6500Handler::fifoDataComplete(void* context, const I2cTransaction& transaction, I2cStatus status) {
+    MPU6500Handler* mpu = static_cast<MPU6500Handler*>(context);
+    mpu->readState = MPU_READ_IDLE;
+    if (status == I2C_OK) mpu->processSamples(mpu->fifoBuffer, mpu->fifoSamples);
+}
+
+void MPU6500Handler::processSamples(const uint8_t* data, uint8_t samples) {
+    // Chaque échantillon est intégré sur son intervalle réel (horodatage de l'interruption),
+    // ou sur la période nominale de l'horloge du capteur
+    float angleChange = 0.0;
+    float duration = 0.0;
+    bool biasUpdated = false;
+    for (uint8_t i = 0; i < samples; i++) {
+        const uint8_t* sample = data + i * FIFO_SAMPLE_BYTES;
+        int16_t rawTemperature = (int16_t)((sample[0] << 8) | sample[1]);
+        int16_t raw = (int16_t)((sample[2] << 8) | sample[3]);
+        
+        temperature = rawTemperature / tempSensitivity + tempOffset;
+        float rawRate = raw / 131.0;
+        biasUpdated |= bias.addSample(rawRate, temperature, stationary);
+        float rate = rawRate - bias.getBias(temperature);
+        float dt;
+        if (!interruptMode || !sampleTimer.nextInterval(dt, SAMPLE_PERIOD)) dt = SAMPLE_PERIOD;
+        angleChange += rate * dt;
+        duration += dt;
+    }
+    robotAngle = normalizeAngle(robotAngle + angleChange);
+    
+    // Horodatages sans échantillon correspondant : file désynchronisée
+    if (interruptMode && sampleTimer.pending() > MPU_FIFO_BURST_SAMPLES) sampleTimer.clear();
+    
+    lastSampleTime = millis();
+    lastRate = angleChange / duration;
+    lastDt = duration;
+    batchReady = true;
+    
+    // Sauvegarde rare, seulement à l'arrêt (l'écriture en flash bloque quelques ms)
+    if (biasUpdated && millis() - lastBiasSave >= MPU_BIAS_SAVE_INTERVAL &&
+        (fabs(bias.getOffset() - savedOffset) >= MPU_BIAS_SAVE_MIN_CHANGE ||
+         fabs(bias.getSlope() - savedSlope) * 10.0 >= MPU_BIAS_SAVE_MIN_CHANGE)) {   // Écart sur 10 °C
+        saveBiasModel();
+    }
+}
+
+void MPU6500Handler::loadBiasModel() {
+    GyroBiasRecord record;
+    EEPROM.get(MPU_BIAS_EEPROM_ADDR, record);
+    if (record.magic != BIAS_RECORD_MAGIC || record.check != biasRecordCheck(record)) return;
+    if (isnan(record.offset) || isnan(record.slope)) return;
+    
+    bias.setModel(record.offset, record.slope);
+    savedOffset = record.offset;
+    savedSlope = record.slope;
+    
+    Serial.print("(biais mémorisé: "); Serial.print(record.offset, 3);
+    Serial.print("°/s, "); Serial.print(record.slope, 4); Serial.print("°/s/°C) ");
+}
+
+void MPU6500Handler::saveBiasModel() {
+    GyroBiasRecord record;
+    record.magic = BIAS_RECORD_MAGIC;
+    record.offset = bias.getOffset();
+    record.slope = bias.getSlope();
+    record.check = biasRecordCheck(record);
+    EEPROM.put(MPU_BIAS_EEPROM_ADDR, record);
+    
+    savedOffset = record.offset;
+    savedSlope = record.slope;
+    lastBiasSave = millis();
+}
+
+void MPU6500Handler::writeRegister(uint8_t reg, uint8_t value) const {
+    Wire.beginTransmission(MPU6500_ADDR);
+    Wire.write(reg);
+    Wire.write(value);
+    Wire.endTransmission(true);
+}
+
+bool MPU6500Handler::readRegisters(uint8_t reg, uint8_t* data, uint8_t count) const {
+    Wire.beginTransmission(MPU6500_ADDR);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) return false;
+    if (Wire.requestFrom(MPU6500_ADDR, (int)count, true) != count) return false;
+    
+    for (uint8_t i = 0; i < count; i++) data[i] = Wire.read();
+    return true;
+}
+
+void MPU6500Handler::drainBus() {
+    // Accès Wire direct à suivre : aucune lecture FIFO ne doit rester en file derrière
+    while (!bus.isIdle()) bus.poll();
+    batchReady = false;   // Lot lu avant la remise à zéro : abandonné
 }
 
 void MPU6500Handler::calibrate() {
     if (!gyroOK) return;
     
+    drainBus();
     Serial.print("Calibration gyroscope (ne pas bouger)... ");
     
     float sum = 0;
@@ -79,11 +305,12 @@ void MPU6500Handler::calibrate() {
         delay(2);
     }
     
-    gyroOffset = sum / GYRO_SAMPLES_CALIBRATION;
+    bias.setBias(sum / GYRO_SAMPLES_CALIBRATION, readTemperature());
     robotAngle = 0.0;  // Reset de l'angle
+    resetFifo();       // Échantillons accumulés pendant la calibration ignorés
     
     Serial.print("✅ Terminé (offset: ");
-    Serial.print(gyroOffset, 2);
+    Serial.print(bias.getOffset(), 2);
     Serial.println("°/s)");
 }
 
@@ -102,6 +329,12 @@ float MPU6500Handler::readGyroZ() const {
     return 0.0;
 }
 
+float MPU6500Handler::readTemperature() const {
+    uint8_t data[2];
+    if (!readRegisters(REG_TEMP_OUT_H, data, 2)) return temperature;
+    return (int16_t)((data[0] << 8) | data[1]) / tempSensitivity + tempOffset;
+}
+
 bool MPU6500Handler::isGyroOK() const {
     return gyroOK;
 }
@@ -111,7 +344,47 @@ float MPU6500Handler::getRobotAngle() const {
 }
 
 float MPU6500Handler::getRotationSpeed() const {
-    return readGyroZ() - gyroOffset;
+    return lastRate;
+}
+
+float MPU6500Handler::getLastRate() const {
+    return lastRate;
+}
+
+float MPU6500Handler::getLastDt() const {
+    return lastDt;
+}
+
+unsigned long MPU6500Handler::getFifoOverflows() const {
+    return fifoOverflows;
+}
+
+unsigned long MPU6500Handler::getMissedTimestamps() const {
+    return sampleTimer.getDropped();
+}
+
+void MPU6500Handler::setStationary(bool isStationary) {
+    stationary = isStationary;
+}
+
+float MPU6500Handler::getGyroOffset() const {
+    return bias.getBias(temperature);
+}
+
+float MPU6500Handler::getBiasSlope() const {
+    return bias.getSlope();
+}
+
+float MPU6500Handler::getTemperature() const {
+    return temperature;
+}
+
+bool MPU6500Handler::isBiasValid() const {
+    return bias.isValid();
+}
+
+uint32_t MPU6500Handler::getBiasUpdates() const {
+    return bias.getUpdateCount();
 }
 
 void MPU6500Handler::resetAngle() {
@@ -194,9 +467,9 @@ void MPU6500Handler::testGyroLive() {
     
     while (millis() - start_time < 15000) {  // 15 secondes
         float raw_gyro = readGyroZ();
-        float corrected_gyro = raw_gyro - gyroOffset;
+        float corrected_gyro = raw_gyro - bias.getBias(temperature);
         
-        update();
+        updateNow();
         
         Serial.print("Raw: "); Serial.print(raw_gyro, 2);
         Serial.print(" | Corrigé: "); Serial.print(corrected_gyro, 2);
@@ -257,6 +530,7 @@ void MPU6500Handler::debugMPU6500() {
 
 void MPU6500Handler::resetMPU6500() {
     Serial.println("🔄 RESET FORCÉ MPU-6500");
+    drainBus();
     
     Wire.beginTransmission(MPU6500_ADDR);
     Wire.write(0x6B);  // PWR_MGMT_1
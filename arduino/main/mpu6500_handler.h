@@ -4,26 +4,81 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include "config.h"
+#include "imu_sample_timer.h"
+#include "gyro_bias.h"
+#include "i2c_bus.h"
+
+// Lecture asynchrone de la FIFO par la file I2C
+enum MpuReadState {
+    MPU_READ_IDLE,
+    MPU_READ_COUNT,   // FIFO_COUNT demandé
+    MPU_READ_DATA     // Lot d'échantillons demandé
+};
 
 class MPU6500Handler {
 private:
-    float gyroOffset;
+    I2cBus& bus;
+    MpuReadState readState;
+    uint8_t countBuffer[2];
+    uint8_t fifoBuffer[MPU_FIFO_BURST_SAMPLES * 4];
+    uint8_t fifoSamples;
+    bool batchReady;          // Lot intégré, pas encore signalé par update()
+    
+    GyroBiasEstimator bias;   // Biais suivi en continu, remplace l'offset fixe
+    bool stationary;          // Moteurs arrêtés (fourni par le contrôleur)
+    float temperature;        // Dernière température lue avec le gyroscope (°C)
+    float tempSensitivity;    // LSB/°C (dépend du modèle de capteur)
+    float tempOffset;         // °C pour une lecture nulle
+    float savedOffset, savedSlope;
+    unsigned long lastBiasSave;
     float robotAngle;
-    unsigned long lastGyroTime;
+    float lastRate;     // Vitesse moyenne du dernier lot intégré (°/s), sans accès au bus
+    float lastDt;       // Durée couverte par ce lot (s)
     bool gyroOK;
+    unsigned long fifoOverflows;
+    
+    // Mode interruption : horodatage de chaque échantillon par la broche INT
+    bool interruptMode;
+    unsigned long lastSampleTime;   // millis() du dernier lot lu
+    ImuSampleTimer sampleTimer;
+    static MPU6500Handler* interruptInstance;
+    static void dataReadyISR();
     
     float readGyroZ() const;
+    float readTemperature() const;
+    void loadBiasModel();
+    void saveBiasModel();
+    void configureSampling();
+    void resetFifo();
+    void queueFifoReset();
+    void drainBus();
+    void processSamples(const uint8_t* data, uint8_t samples);
+    static void fifoCountComplete(void* context, const I2cTransaction& transaction, I2cStatus status);
+    static void fifoDataComplete(void* context, const I2cTransaction& transaction, I2cStatus status);
+    void writeRegister(uint8_t reg, uint8_t value) const;
+    bool readRegisters(uint8_t reg, uint8_t* data, uint8_t count) const;
     static double normalizeAngle(double angle);
     static double normalizeAngleDiff(double angle_diff);
     
 public:
-    MPU6500Handler();
+    explicit MPU6500Handler(I2cBus& i2cBus);
     void init();
-    void update();
+    bool update();      // true si un nouvel échantillon a été intégré
+    bool updateNow();   // Diagnostics bloquants : la file I2C est exécutée sur place
+    void setStationary(bool isStationary);
     void calibrate();
     bool isGyroOK() const;
     float getRobotAngle() const;
     float getRotationSpeed() const;
+    float getLastRate() const;
+    float getLastDt() const;
+    unsigned long getFifoOverflows() const;
+    unsigned long getMissedTimestamps() const;
+    float getGyroOffset() const;
+    float getBiasSlope() const;
+    float getTemperature() const;
+    bool isBiasValid() const;
+    uint32_t getBiasUpdates() const;
     void resetAngle();
     
     // Fonctions de test et diagnostic
@@ -1,198 +1,371 @@
 #include "navigation_controller.h"
+#include "logger.h"
+#include "mission_codec.h"
 
-NavigationController::NavigationController(GPSHandler* gps, MPU6500Handler* mpu, MotorController* motor) 
-    : gpsHandler(gps), mpuHandler(mpu), motorController(motor),
-      targetLat(0.0), targetLng(0.0), targetSet(false), navigating(false) {
+NavigationController::NavigationController(GPSHandler* gps, MPU6500Handler* mpu, MotorController* motor,
+                                           PoseEstimator* pose) 
+    : gpsHandler(gps), mpuHandler(mpu), motorController(motor), poseEstimator(pose),
+      currentLeg(0), missionStart(), missionDistance(0.0), navigating(false),
+      steering(false), lastSteerTime(0) {
 }
 
 void NavigationController::init() {
+    // Mission mémorisée : disponible dès le démarrage, sans renvoi
+    missionStore.init();
+    if (missionStore.isUploading()) {
+        Serial.print("📥 Envoi de mission interrompu: ");
+        Serial.print(missionStore.getReceived()); Serial.print("/");
+        Serial.print(missionStore.getLength()); Serial.println(" octets, reprise possible");
+    } else if (missionStore.isComplete() && !loadMission()) {
+        Serial.println("⚠️ Mission mémorisée illisible");
+    }
     Serial.println("✅ Contrôleur de navigation initialisé");
 }
 
 void NavigationController::update() {
-    if (navigating && targetSet && gpsHandler->isPositionValid()) {
+    if (navigating && !mission.isEmpty() && poseEstimator->isPositionValid()) {
         navigate();
+    } else {
+        steering = false;
     }
 }
 
 void NavigationController::navigate() {
-    // 1. Calculer distance et direction vers la cible
-    double distance = GPSHandler::calculateDistance(
-        gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude(), 
-        targetLat, targetLng
-    );
-    double target_bearing = GPSHandler::calculateBearing(
-        gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude(), 
-        targetLat, targetLng
-    );
-    
-    Serial.print("Distance: ");
-    Serial.print(distance, 1);
-    Serial.print("m | Direction cible: ");
-    Serial.print(target_bearing, 1);
-    Serial.print("°");
+    // 1. Distance vers le point courant depuis la pose estimée (gyroscope + GPS)
+    Pose pose = poseEstimator->getPose();
+    PathPoint position = { pose.x, pose.y };
+    const Waypoint& waypoint = mission.get(currentLeg);
+    PathPoint target = waypointPosition(currentLeg);
+    PathPoint start = legStart(currentLeg);
+    bool lastLeg = currentLeg + 1 >= mission.size();
     
-    if (mpuHandler->isGyroOK()) {
-        Serial.print(" | Angle robot: ");
-        Serial.print(mpuHandler->getRobotAngle(), 1);
-        Serial.println("°");
-    } else {
-        Serial.println();
-    }
+    double distance = PurePursuit::distance(position, target);
+    logEvent<LOG_NAV, LOG_LEVEL_DEBUG>(EVT_NAV_DISTANCE_DM, (int32_t)(distance * 10));
     
-    // 2. Vérifier si on est arrivé
-    if (distance <= ARRIVAL_DISTANCE) {
-        Serial.println("🎯 ARRIVÉ À DESTINATION!");
-        motorController->stop();
-        navigating = false;
+    // 2. Point atteint (ou dépassé) : le suivant enchaîne sans arrêt, le dernier termine la mission
+    if (PurePursuit::legReached(start, target, position, waypoint.arrivalRadius, lastLeg)) {
+        if (lastLeg) {
+            logEvent<LOG_NAV, LOG_LEVEL_INFO>(EVT_NAV_ARRIVED, (int32_t)(distance * 10));
+            motorController->stop();
+            navigating = false;
+            steering = false;
+        } else {
+            logEvent<LOG_NAV, LOG_LEVEL_INFO>(EVT_NAV_WAYPOINT, currentLeg);
+            currentLeg++;
+        }
         return;
     }
     
-    // 3. Navigation avec ou sans gyroscope
+    // 3. Point de visée à distance croissante avec la vitesse du tronçon
+    PathPoint next;
+    if (!lastLeg) next = waypointPosition(currentLeg + 1);
+    PathPoint goal = PurePursuit::goal(start, target, lastLeg ? NULL : &next, position,
+                                       PurePursuit::lookahead(waypoint.speed));
+    
+    double target_bearing = LocalFrame::fastAtan2(goal.x - position.x, goal.y - position.y) * 180.0 / PI;
+    if (target_bearing < 0.0) target_bearing += 360.0;
+    
+    logEvent<LOG_NAV, LOG_LEVEL_DEBUG>(EVT_NAV_BEARING_DDEG, (int32_t)(target_bearing * 10));
+    if (mpuHandler->isGyroOK()) {
+        logEvent<LOG_NAV, LOG_LEVEL_DEBUG>(EVT_NAV_ANGLE_DDEG, (int32_t)(pose.heading * 10));
+    }
+    
+    // 4. Navigation avec ou sans gyroscope
     if (mpuHandler->isGyroOK()) {
         // Navigation avec gyroscope (précise)
-        double angle_error = target_bearing - mpuHandler->getRobotAngle();
+        double angle_error = target_bearing - pose.heading;
         angle_error = MPU6500Handler::normalizeAngleDiffPublic(angle_error);
         
-        Serial.print("Erreur d'angle: ");
-        Serial.print(angle_error, 1);
-        Serial.print("° | ");
-        
-        if (abs(angle_error) > ANGLE_TOLERANCE) {
-            // Besoin de tourner
-            int turn_speed = motorController->calculateTurnSpeed(angle_error);
-            
-            Serial.print("🔄 Correction ");
-            
-            if (angle_error > 0) {
-                Serial.print("droite | Angle: ");
-                Serial.print(angle_error, 1);
-                Serial.print("° | Vitesse: ");
-                Serial.println(turn_speed);
-                motorController->turnRight(turn_speed);
-            } else {
-                Serial.print("gauche | Angle: ");
-                Serial.print(abs(angle_error), 1);
-                Serial.print("° | Vitesse: ");
-                Serial.println(turn_speed);
-                motorController->turnLeft(turn_speed);
-            }
-            
-            // Attendre que la rotation se fasse
-            unsigned long turn_duration = map(abs(angle_error), 8, 180, 200, 1000);
-            delay(turn_duration);
-            
-            motorController->stop();
-            delay(150);  // Pause pour stabiliser
-            
-        } else {
-            // Direction correcte, avancer
-            Serial.println("➡️ Avance vers la cible");
-            motorController->goForward();
-        }
+        logEvent<LOG_NAV, LOG_LEVEL_DEBUG>(EVT_NAV_ERROR_DDEG, (int32_t)(angle_error * 10));
+        steer(angle_error, min(waypoint.speed / MOTOR_PWM_TO_MPS, (float)MOTOR_MAX_PWM));
     } else {
         // Navigation GPS seule (moins précise)
-        Serial.println("⚠️ Navigation GPS seule - Gyroscope non disponible");
-        Serial.println("➡️ Avance vers la cible");
+        logEvent<LOG_NAV, LOG_LEVEL_WARN>(EVT_NAV_GPS_ONLY);
         motorController->goForward();
     }
 }
 
-void NavigationController::handleCommands() {
-    if (!Serial.available()) return;
+PathPoint NavigationController::waypointPosition(uint8_t index) const {
+    const Waypoint& waypoint = mission.get(index);
+    PathPoint point;
+    poseEstimator->toLocal(waypoint.latitude(), waypoint.longitude(), point.x, point.y);
+    return point;
+}
+
+PathPoint NavigationController::legStart(uint8_t index) const {
+    return index == 0 ? missionStart : waypointPosition(index - 1);
+}
+
+void NavigationController::steer(double angle_error, float forwardPwm) {
+    // Différentiel des roues proportionnel à l'erreur de cap, sans arrêt pour tourner
+    unsigned long now = micros();
+    float dt = steering ? (now - lastSteerTime) / 1000000.0 : TASK_PERIOD_NAVIGATION / 1000000.0;
+    lastSteerTime = now;
+    if (!steering) {
+        headingController.reset();
+        steering = true;
+    }
     
-    String cmd = Serial.readStringUntil('\n');
-    cmd.trim();
-    cmd.toLowerCase();
+    float turn = headingController.update(angle_error, mpuHandler->getRotationSpeed(), dt);
+    int left, right;
+    HeadingController::mix(forwardPwm, turn, angle_error, left, right);
     
-    if (cmd.startsWith("set ")) {
-        setTarget(cmd.substring(4));
-    }
-    else if (cmd == "go") {
-        startNavigation();
-    }
-    else if (cmd == "stop") {
-        stopNavigation();
-    }
-    else if (cmd == "status") {
-        printStatus();
-    }
-    else if (cmd == "calibrate") {
-        mpuHandler->calibrate();
+    logEvent<LOG_NAV, LOG_LEVEL_DEBUG>(EVT_NAV_STEER_PWM, (int32_t)turn);
+    motorController->drive(left, right);
+}
+
+bool NavigationController::registerCommands(CommandRegistry& registry) {
+    static const uint32_t COMMANDS[] = {
+        commandId("set"), commandId("go"), commandId("status"), commandId("calibrate"),
+        commandId("gyro_test"), commandId("scan"), commandId("mpu_debug"), commandId("mpu_reset"),
+        commandId("turn_test"), commandId("gyro_live"), commandId("test"), commandId("speed_test"),
+        commandId("add"), commandId("clear"), commandId("route"), commandId("mission_save"),
+        commandId("mission_load")
+    };
+    static_assert(sizeof(COMMANDS) / sizeof(COMMANDS[0]) + 2 == NAVIGATION_COMMAND_COUNT,
+                  "NAVIGATION_COMMAND_COUNT à mettre à jour");
+    
+    bool ok = true;
+    for (uint8_t i = 0; i < sizeof(COMMANDS) / sizeof(COMMANDS[0]); i++) {
+        ok &= registry.add(COMMANDS[i], commandHandler, this);
     }
-    else if (cmd == "gyro_test") {
-        mpuHandler->testGyroscope();
+    
+    // Envoi de mission par morceaux : aussi en WiFi (arguments dans le paramètre arg=)
+    ok &= registry.add(commandId("mission_begin"), commandHandler, this, CMD_SOURCE_ANY);
+    ok &= registry.add(commandId("mission_chunk"), commandHandler, this, CMD_SOURCE_ANY);
+    return ok;
+}
+
+CommandResult NavigationController::commandHandler(void* target, const CommandRequest& request) {
+    NavigationController* nav = static_cast<NavigationController*>(target);
+    
+    switch (request.id) {
+        case commandId("set"):        nav->setTarget(request.args); break;
+        case commandId("go"):         nav->startNavigation(); break;
+        case commandId("status"):     nav->printStatus(); break;
+        case commandId("calibrate"):  nav->mpuHandler->calibrate(); break;
+        case commandId("gyro_test"):  nav->mpuHandler->testGyroscope(); break;
+        case commandId("scan"):       nav->mpuHandler->scanI2C(); break;
+        case commandId("mpu_debug"):  nav->mpuHandler->debugMPU6500(); break;
+        case commandId("mpu_reset"):  nav->mpuHandler->resetMPU6500(); break;
+        case commandId("turn_test"):  nav->testTurning(); break;
+        case commandId("gyro_live"):  nav->mpuHandler->testGyroLive(); break;
+        case commandId("test"):       nav->motorController->testMotors(); break;
+        case commandId("speed_test"): nav->testSpeedMapping(); break;
+        case commandId("add"):        nav->addWaypoint(request.args); break;
+        case commandId("clear"):      nav->clearMission(); break;
+        case commandId("route"):      nav->printMission(); break;
+        case commandId("mission_save"): nav->saveMission(); break;
+        case commandId("mission_load"): nav->loadMission(); break;
+        case commandId("mission_begin"): return nav->beginUpload(request.args);
+        case commandId("mission_chunk"): return nav->receiveChunk(request.args);
+        default:                      return CMD_UNKNOWN;
     }
-    else if (cmd == "scan") {
-        mpuHandler->scanI2C();
+    return CMD_OK;
+}
+
+bool NavigationController::parseWaypoint(const char* args, Waypoint& waypoint) const {
+    // "48°50'18"N,2°18'41"E[,vitesse m/s[,rayon m]]"
+    const char* comma = strchr(args, ',');
+    if (comma == NULL) {
+        Serial.println("❌ Format invalide. Exemple: 48°50'18\"N,2°18'41\"E[,0.4[,2]]");
+        return false;
     }
-    else if (cmd == "mpu_debug") {
-        mpuHandler->debugMPU6500();
+    
+    const char* lngField = comma + 1;
+    const char* options = strchr(lngField, ',');
+    size_t lngLength = options != NULL ? (size_t)(options - lngField) : strlen(lngField);
+    
+    double lat = GPSHandler::parseDMS(args, comma - args);
+    double lng = GPSHandler::parseDMS(lngField, lngLength);
+    if (isnan(lat) || isnan(lng)) {
+        Serial.println("❌ Coordonnées invalides");
+        return false;
     }
-    else if (cmd == "mpu_reset") {
-        mpuHandler->resetMPU6500();
+    
+    waypoint.latE6 = lround(lat * 1e6);
+    waypoint.lngE6 = lround(lng * 1e6);
+    waypoint.speed = MISSION_DEFAULT_SPEED;
+    waypoint.arrivalRadius = MISSION_DEFAULT_RADIUS;
+    
+    if (options != NULL) {
+        waypoint.speed = atof(options + 1);
+        const char* radius = strchr(options + 1, ',');
+        if (radius != NULL) waypoint.arrivalRadius = atof(radius + 1);
     }
-    else if (cmd == "turn_test") {
-        testTurning();
+    if (waypoint.speed <= 0.0 || waypoint.arrivalRadius <= 0.0) {
+        Serial.println("❌ Vitesse et rayon doivent être positifs");
+        return false;
     }
-    else if (cmd == "gyro_live") {
-        mpuHandler->testGyroLive();
+    return true;
+}
+
+void NavigationController::setTarget(const char* coords) {
+    // Destination unique : mission d'un seul point
+    Waypoint waypoint;
+    if (!parseWaypoint(coords, waypoint)) return;
+    if (navigating) stopNavigation();
+    
+    mission.clear();
+    mission.add(waypoint);
+    Serial.println("✅ Destination définie:");
+    Serial.print("   Latitude: "); Serial.println(waypoint.latitude(), 6);
+    Serial.print("   Longitude: "); Serial.println(waypoint.longitude(), 6);
+    
+    if (gpsHandler->isPositionValid()) {
+        LocalFrame targetFrame;
+        targetFrame.setOrigin(waypoint.latitude(), waypoint.longitude());
+        double dist = targetFrame.distanceToOrigin(
+            gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude()
+        );
+        double bearing = targetFrame.bearingToOrigin(
+            gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude()
+        );
+        Serial.print("   Distance: "); Serial.print(dist, 1); Serial.println("m");
+        Serial.print("   Direction: "); Serial.print(bearing, 1); Serial.println("°");
     }
-    else if (cmd == "test") {
-        motorController->testMotors();
+}
+
+void NavigationController::addWaypoint(const char* args) {
+    Waypoint waypoint;
+    if (!parseWaypoint(args, waypoint)) return;
+    
+    // Ajout possible en cours de mission : le trajet s'allonge
+    if (!mission.add(waypoint)) {
+        Serial.println("❌ Mission pleine");
+        return;
     }
-    else if (cmd == "speed_test") {
-        testSpeedMapping();
+    // Longueur totale mise à jour, sinon l'avancement resterait bloqué à 0
+    uint8_t last = mission.size() - 1;
+    if (navigating) missionDistance += PurePursuit::distance(legStart(last), waypointPosition(last));
+    
+    Serial.print("✅ Point "); Serial.print(mission.size());
+    Serial.print(": "); Serial.print(waypoint.latitude(), 6);
+    Serial.print(", "); Serial.print(waypoint.longitude(), 6);
+    Serial.print(" | "); Serial.print(waypoint.speed, 2);
+    Serial.print("m/s | rayon "); Serial.print(waypoint.arrivalRadius, 1); Serial.println("m");
+}
+
+void NavigationController::clearMission() {
+    if (navigating) stopNavigation();
+    mission.clear();
+    currentLeg = 0;
+    Serial.println("✅ Mission effacée");
+}
+
+void NavigationController::printMission() {
+    Serial.print("=== MISSION ("); Serial.print(mission.size()); Serial.println(" points) ===");
+    for (uint8_t i = 0; i < mission.size(); i++) {
+        const Waypoint& waypoint = mission.get(i);
+        Serial.print(navigating && i == currentLeg ? "-> " : "   ");
+        Serial.print(i + 1); Serial.print(". ");
+        Serial.print(waypoint.latitude(), 6); Serial.print(", "); Serial.print(waypoint.longitude(), 6);
+        Serial.print(" | "); Serial.print(waypoint.speed, 2);
+        Serial.print("m/s | rayon "); Serial.print(waypoint.arrivalRadius, 1); Serial.println("m");
     }
-    else {
-        Serial.println("❓ Commande inconnue");
+    if (navigating) {
+        Serial.print("Restant: "); Serial.print(getRemainingDistance(), 1);
+        Serial.print("m | ETA: "); Serial.print(getEta(), 0);
+        Serial.print("s | Avancement: "); Serial.print(getProgress() * 100.0, 0); Serial.println("%");
     }
+    Serial.println("==================");
 }
 
-void NavigationController::setTarget(String coords) {
-    // Parse "48°50'18"N,2°18'41"E"
-    int comma = coords.indexOf(',');
-    if (comma == -1) {
-        Serial.println("❌ Format invalide. Exemple: 48°50'18\"N,2°18'41\"E");
+void NavigationController::saveMission() {
+    if (!missionStore.save(mission)) {
+        Serial.println("❌ Mission vide ou trop grande pour l'EEPROM");
         return;
     }
+    Serial.print("💾 Mission mémorisée: "); Serial.print(missionStore.getCount());
+    Serial.print(" points, "); Serial.print(missionStore.getLength()); Serial.println(" octets");
+}
+
+bool NavigationController::loadMission() {
+    if (navigating) stopNavigation();
+    currentLeg = 0;
+    if (!missionStore.load(mission)) {
+        Serial.println("❌ Aucune mission mémorisée valide");
+        return false;
+    }
+    Serial.print("📂 Mission chargée: "); Serial.print(mission.size()); Serial.println(" points");
+    return true;
+}
+
+CommandResult NavigationController::beginUpload(const char* args) {
+    // "points,octets,crc32 hexadécimal"
+    char* end;
+    unsigned long count = strtoul(args, &end, 10);
+    if (*end != ',') return CMD_INVALID;
+    unsigned long length = strtoul(end + 1, &end, 10);
+    if (*end != ',') return CMD_INVALID;
+    uint32_t crc = strtoul(end + 1, &end, 16);
+    if (*end != '\0' || count > 0xFFFF || length > 0xFFFF) return CMD_INVALID;
     
-    String lat_str = coords.substring(0, comma);
-    String lng_str = coords.substring(comma + 1);
-    
-    targetLat = GPSHandler::parseDMS(lat_str);
-    targetLng = GPSHandler::parseDMS(lng_str);
-    
-    if (isnan(targetLat) || isnan(targetLng)) {
-        Serial.println("❌ Coordonnées invalides");
-        return;
+    if (!missionStore.begin(count, length, crc)) {
+        Serial.println("❌ Mission trop grande");
+        return CMD_INVALID;
     }
+    Serial.print("📥 Envoi de mission: "); Serial.print(missionStore.getReceived());
+    Serial.print("/"); Serial.print(missionStore.getLength()); Serial.println(" octets déjà reçus");
+    return CMD_OK;
+}
+
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+CommandResult NavigationController::receiveChunk(const char* args) {
+    // "position,données hexadécimales,crc32 hexadécimal du morceau"
+    char* end;
+    unsigned long offset = strtoul(args, &end, 10);
+    if (*end != ',' || offset > 0xFFFF) return CMD_INVALID;
     
-    targetSet = true;
-    Serial.println("✅ Destination définie:");
-    Serial.print("   Latitude: "); Serial.println(targetLat, 6);
-    Serial.print("   Longitude: "); Serial.println(targetLng, 6);
+    uint8_t data[MISSION_CHUNK_MAX];
+    uint8_t length = 0;
+    const char* hex = end + 1;
+    while (*hex != ',' && *hex != '\0') {
+        int high = hexDigit(hex[0]);
+        int low = high >= 0 ? hexDigit(hex[1]) : -1;
+        if (low < 0 || length >= MISSION_CHUNK_MAX) return CMD_INVALID;
+        data[length++] = (uint8_t)((high << 4) | low);
+        hex += 2;
+    }
+    if (*hex != ',') return CMD_INVALID;
+    uint32_t crc = strtoul(hex + 1, &end, 16);
+    if (*end != '\0') return CMD_INVALID;
     
-    if (gpsHandler->isPositionValid()) {
-        double dist = GPSHandler::calculateDistance(
-            gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude(), 
-            targetLat, targetLng
-        );
-        double bearing = GPSHandler::calculateBearing(
-            gpsHandler->getCurrentLatitude(), gpsHandler->getCurrentLongitude(), 
-            targetLat, targetLng
-        );
-        Serial.print("   Distance: "); Serial.print(dist, 1); Serial.println("m");
-        Serial.print("   Direction: "); Serial.print(bearing, 1); Serial.println("°");
+    switch (missionStore.writeChunk(offset, data, length, crc)) {
+        case MISSION_CHUNK_OK:
+            return CMD_OK;
+        case MISSION_CHUNK_COMPLETE:
+            // Mission en cours jamais interrompue par un envoi : la nouvelle attend mission_load
+            if (navigating) {
+                Serial.println("✅ Mission reçue et mémorisée, appliquée par mission_load après l'arrêt");
+            } else {
+                Serial.println("✅ Mission reçue");
+                loadMission();
+            }
+            return CMD_OK;
+        case MISSION_CHUNK_CORRUPT:
+            // Octets reçus remis à 0 : le renvoi repart du début
+            Serial.println("❌ CRC de la mission faux, envoi à recommencer");
+            return CMD_RESEND;
+        default:
+            Serial.print("❌ Morceau refusé, attendu à partir de l'octet ");
+            Serial.println(missionStore.getReceived());
+            return CMD_RESEND;
     }
 }
 
 void NavigationController::startNavigation() {
-    if (!targetSet) {
+    if (mission.isEmpty()) {
         Serial.println("❌ Aucune destination définie");
         return;
     }
-    if (!gpsHandler->isPositionValid()) {
+    if (!gpsHandler->isPositionValid() || !poseEstimator->isPositionValid()) {
         Serial.println("❌ Position GPS non disponible");
         return;
     }
@@ -200,12 +373,25 @@ void NavigationController::startNavigation() {
         Serial.println("⚠️ Gyroscope non disponible - Navigation GPS seule");
     }
     
+    // Le premier tronçon part de la position actuelle
+    Pose pose = poseEstimator->getPose();
+    missionStart.x = pose.x;
+    missionStart.y = pose.y;
+    currentLeg = 0;
+    missionDistance = 0.0;
+    for (uint8_t i = 0; i < mission.size(); i++) {
+        missionDistance += PurePursuit::distance(legStart(i), waypointPosition(i));
+    }
+    
     navigating = true;
-    Serial.println("🚀 NAVIGATION DÉMARRÉE");
+    steering = false;
+    Serial.print("🚀 NAVIGATION DÉMARRÉE ("); Serial.print(mission.size());
+    Serial.print(" points, "); Serial.print(missionDistance, 0); Serial.println("m)");
 }
 
 void NavigationController::stopNavigation() {
     navigating = false;
+    steering = false;
     motorController->stop();
     Serial.println("🛑 Navigation arrêtée");
 }
@@ -214,7 +400,7 @@ void NavigationController::printStatus() {
     Serial.println("=== ÉTAT ACTUEL ===");
     Serial.print("GPS: "); Serial.println(gpsHandler->isPositionValid() ? "✅ OK" : "❌ Pas de signal");
     Serial.print("MPU-6500: "); Serial.println(mpuHandler->isGyroOK() ? "✅ OK" : "❌ Erreur");
-    Serial.print("Destination: "); Serial.println(targetSet ? "✅ Définie" : "❌ Non définie");
+    Serial.print("Destination: "); Serial.println(!mission.isEmpty() ? "✅ Définie" : "❌ Non définie");
     Serial.print("Navigation: "); Serial.println(navigating ? "🚀 Active" : "⏸️ Arrêtée");
     
     if (gpsHandler->isPositionValid()) {
@@ -224,10 +410,23 @@ void NavigationController::printStatus() {
     if (mpuHandler->isGyroOK()) {
         Serial.print("Angle robot: "); Serial.print(mpuHandler->getRobotAngle(), 1); Serial.println("°");
         Serial.print("Vitesse rotation: "); Serial.print(mpuHandler->getRotationSpeed(), 2); Serial.println("°/s");
+        Serial.print("Débordements FIFO: "); Serial.println(mpuHandler->getFifoOverflows());
+        Serial.print("Horodatages perdus: "); Serial.println(mpuHandler->getMissedTimestamps());
+        Serial.print("Biais gyroscope: "); Serial.print(mpuHandler->getGyroOffset(), 3);
+        Serial.print("°/s ("); Serial.print(mpuHandler->getBiasUpdates()); Serial.print(" mises à jour, ");
+        Serial.print(mpuHandler->getBiasSlope(), 4); Serial.print("°/s/°C à ");
+        Serial.print(mpuHandler->getTemperature(), 1); Serial.println("°C)");
+    }
+    if (!mission.isEmpty()) {
+        const Waypoint& waypoint = mission.get(navigating ? currentLeg : mission.size() - 1);
+        Serial.print("Destination: "); Serial.print(waypoint.latitude(), 6);
+        Serial.print(", "); Serial.println(waypoint.longitude(), 6);
+        Serial.print("Mission: point "); Serial.print(currentLeg + 1);
+        Serial.print("/"); Serial.println(mission.size());
     }
-    if (targetSet) {
-        Serial.print("Destination: "); Serial.print(targetLat, 6);
-        Serial.print(", "); Serial.println(targetLng, 6);
+    if (navigating) {
+        Serial.print("Restant: "); Serial.print(getRemainingDistance(), 1);
+        Serial.print("m | ETA: "); Serial.print(getEta(), 0); Serial.println("s");
     }
     Serial.println("==================");
 }
@@ -247,40 +446,35 @@ void NavigationController::testTurning() {
     Serial.print("Angle initial: "); Serial.print(start_angle, 1);
     Serial.print("° | Cible: "); Serial.print(target_angle, 1); Serial.println("°");
     
+    HeadingController controller;
     unsigned long start_time = millis();
     while (millis() - start_time < 15000) {  // Max 15 secondes
         
         // Forcer la lecture du gyroscope
-        mpuHandler->update();
+        mpuHandler->updateNow();
         
         // Calculer l'erreur d'angle
         double angle_error = target_angle - mpuHandler->getRobotAngle();
         angle_error = MPU6500Handler::normalizeAngleDiffPublic(angle_error);
         
-        // Calculer la vitesse adaptative
-        int turn_speed = motorController->calculateTurnSpeed(angle_error);
-        
-        // Afficher les données
+        // Régulateur de cap, sans avance : rotation sur place
         float gyro_speed = mpuHandler->getRotationSpeed();
+        float turn = controller.update(angle_error, gyro_speed, 0.1);
+        int left, right;
+        HeadingController::mix(0, turn, angle_error, left, right);
         
         Serial.print("Angle: "); Serial.print(mpuHandler->getRobotAngle(), 1);
         Serial.print("° | Erreur: "); Serial.print(angle_error, 1);
-        Serial.print("° | Vitesse: "); Serial.print(turn_speed);
+        Serial.print("° | Différentiel: "); Serial.print(turn, 0);
         Serial.print(" | Gyro: "); Serial.print(gyro_speed, 1); Serial.println("°/s");
         
-        // Arrêter si proche de la cible
-        if (abs(angle_error) < 4.0) {
+        // Arrêter si proche de la cible et presque immobile
+        if (abs(angle_error) < 4.0 && abs(gyro_speed) < 10.0) {
             Serial.println("🎯 Angle cible atteint!");
             break;
         }
         
-        // Tourner avec la vitesse adaptée
-        if (angle_error > 0) {
-            motorController->turnRight(turn_speed);
-        } else {
-            motorController->turnLeft(turn_speed);
-        }
-        
+        motorController->drive(left, right);
         delay(100);
     }
     
@@ -297,21 +491,27 @@ void NavigationController::testTurning() {
 
 void NavigationController::testSpeedMapping() {
     Serial.println("🔧 TEST MAPPING VITESSE/ANGLE");
-    Serial.println("Test des vitesses selon l'erreur d'angle:");
+    Serial.println("Consignes des roues selon l'erreur de cap (régime établi, sans rotation):");
     
     double test_angles[] = {5, 10, 20, 30, 45, 60, 90, 120, 180};
     int num_tests = sizeof(test_angles) / sizeof(test_angles[0]);
     
     for (int i = 0; i < num_tests; i++) {
         double angle = test_angles[i];
-        int speed = motorController->calculateTurnSpeed(angle);
+        
+        // Terme proportionnel seul (rampe et intégrale exclues)
+        float turn = constrain(HEADING_KP * angle, -HEADING_MAX_DIFF, HEADING_MAX_DIFF);
+        int left, right;
+        HeadingController::mix(MOTOR_SPEED_NORMAL, turn, angle, left, right);
         
         Serial.print("   Angle: ");
         if (angle < 10) Serial.print(" ");
         if (angle < 100) Serial.print(" ");
         Serial.print(angle, 0);
-        Serial.print("° → Vitesse PWM: ");
-        Serial.println(speed);
+        Serial.print("° → Gauche: ");
+        Serial.print(left);
+        Serial.print(" | Droite: ");
+        Serial.println(right);
     }
     
     Serial.println("✅ Mapping terminé");
@@ -322,5 +522,42 @@ bool NavigationController::isNavigating() const {
 }
 
 bool NavigationController::isTargetSet() const {
-    return targetSet;
+    return !mission.isEmpty();
+}
+
+float NavigationController::getRemainingDistance() const {
+    if (!navigating) return 0.0;
+    
+    Pose pose = poseEstimator->getPose();
+    PathPoint position = { pose.x, pose.y };
+    PathPoint previous = waypointPosition(currentLeg);
+    float remaining = PurePursuit::distance(position, previous);
+    for (uint8_t i = currentLeg + 1; i < mission.size(); i++) {
+        PathPoint point = waypointPosition(i);
+        remaining += PurePursuit::distance(previous, point);
+        previous = point;
+    }
+    return remaining;
+}
+
+float NavigationController::getEta() const {
+    if (!navigating) return 0.0;
+    
+    // Chaque tronçon à sa vitesse prévue
+    Pose pose = poseEstimator->getPose();
+    PathPoint position = { pose.x, pose.y };
+    PathPoint previous = waypointPosition(currentLeg);
+    float eta = PurePursuit::distance(position, previous) / mission.get(currentLeg).speed;
+    for (uint8_t i = currentLeg + 1; i < mission.size(); i++) {
+        PathPoint point = waypointPosition(i);
+        eta += PurePursuit::distance(previous, point) / mission.get(i).speed;
+        previous = point;
+    }
+    return eta;
+}
+
+float NavigationController::getProgress() const {
+    if (!navigating || missionDistance <= 0.0) return 0.0;
+    float progress = 1.0 - getRemainingDistance() / missionDistance;
+    return constrain(progress, 0.0, 1.0);
 }
\ No newline at end of file
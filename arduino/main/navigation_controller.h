@@ -6,28 +6,59 @@
 #include "gps_handler.h"
 #include "mpu6500_handler.h"
 #include "motor_controller.h"
+#include "command_registry.h"
+#include "local_frame.h"
+#include "pose_estimator.h"
+#include "heading_controller.h"
+#include "mission.h"
+#include "mission_store.h"
+#include "pure_pursuit.h"
+
+// Commandes ajoutées au registre par registerCommands() (budget vérifié à la compilation)
+const uint8_t NAVIGATION_COMMAND_COUNT = 19;
 
 class NavigationController {
 private:
     GPSHandler* gpsHandler;
     MPU6500Handler* mpuHandler;
     MotorController* motorController;
+    PoseEstimator* poseEstimator;
     
-    // Variables de navigation
-    double targetLat, targetLng;
-    bool targetSet;
+    // Mission : points de passage suivis sans arrêt intermédiaire
+    Mission mission;
+    MissionStore missionStore;   // Copie en EEPROM, rechargée au démarrage
+    uint8_t currentLeg;       // Point visé
+    PathPoint missionStart;   // Position au départ (début du premier tronçon)
+    float missionDistance;    // Longueur totale du trajet (m)
     bool navigating;
     
+    // Cap régulé en roulant
+    HeadingController headingController;
+    bool steering;                  // Régulateur actif depuis lastSteerTime
+    unsigned long lastSteerTime;
+    
     void navigate();
+    void steer(double angle_error, float forwardPwm);
+    PathPoint waypointPosition(uint8_t index) const;
+    PathPoint legStart(uint8_t index) const;
+    bool parseWaypoint(const char* args, Waypoint& waypoint) const;
+    CommandResult beginUpload(const char* args);
+    CommandResult receiveChunk(const char* args);
+    static CommandResult commandHandler(void* target, const CommandRequest& request);
     
 public:
-    NavigationController(GPSHandler* gps, MPU6500Handler* mpu, MotorController* motor);
+    NavigationController(GPSHandler* gps, MPU6500Handler* mpu, MotorController* motor, PoseEstimator* pose);
     void init();
     void update();
-    void handleCommands();
+    bool registerCommands(CommandRegistry& registry);
     
     // Commandes de navigation
-    void setTarget(String coords);
+    void setTarget(const char* coords);
+    void addWaypoint(const char* args);
+    void clearMission();
+    void printMission();
+    void saveMission();
+    bool loadMission();
     void startNavigation();
     void stopNavigation();
     void printStatus();
@@ -39,6 +70,14 @@ public:
     // Getters
     bool isNavigating() const;
     bool isTargetSet() const;
+    
+    // Avancement de la mission (télémétrie)
+    const Mission& getMission() const { return mission; }
+    const MissionStore& getMissionStore() const { return missionStore; }
+    uint8_t getCurrentLeg() const { return currentLeg; }
+    float getRemainingDistance() const;   // m, le long des tronçons restants
+    float getEta() const;                 // s, aux vitesses prévues
+    float getProgress() const;            // 0..1
 };
 
 #endif
\ No newline at end of file
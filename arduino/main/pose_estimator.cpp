@@ -0,0 +1,150 @@
+#include "pose_estimator.h"
+#include "config.h"
+#include <math.h>
+
+static const float DEG_TO_RAD_F = 0.0174532925f;
+
+static float wrapAngle(float angle) {
+    while (angle >= 360.0f) angle -= 360.0f;
+    while (angle < 0.0f) angle += 360.0f;
+    return angle;
+}
+
+static float wrapAngleDiff(float diff) {
+    while (diff > 180.0f) diff -= 360.0f;
+    while (diff < -180.0f) diff += 360.0f;
+    return diff;
+}
+
+PoseEstimator::PoseEstimator() {
+    reset(0.0f);
+}
+
+void PoseEstimator::reset(float heading) {
+    for (uint8_t i = 0; i < POSE_STATE_COUNT; i++) {
+        state[i] = 0.0f;
+        for (uint8_t j = 0; j < POSE_STATE_COUNT; j++) P[i][j] = 0.0f;
+    }
+    state[POSE_HEADING] = wrapAngle(heading);
+    
+    // Position inconnue jusqu'au premier point GPS ; cap relatif au démarrage
+    P[POSE_X][POSE_X] = 1e6f;
+    P[POSE_Y][POSE_Y] = 1e6f;
+    P[POSE_HEADING][POSE_HEADING] = EKF_INITIAL_HEADING_SIGMA * EKF_INITIAL_HEADING_SIGMA;
+    P[POSE_SPEED][POSE_SPEED] = 0.01f;
+    
+    positionValid = false;
+    gpsUpdates = 0;
+}
+
+void PoseEstimator::predict(float rate, float commandedSpeed, float dt) {
+    if (dt <= 0.0f) return;
+    
+    float heading = state[POSE_HEADING] * DEG_TO_RAD_F;
+    float s = sinf(heading);
+    float c = cosf(heading);
+    float v = state[POSE_SPEED];
+    float alpha = dt / EKF_SPEED_TIME_CONSTANT;
+    if (alpha > 1.0f) alpha = 1.0f;
+    
+    // Modèle : vitesse qui rejoint la consigne au premier ordre, avance selon le cap
+    state[POSE_X] += v * s * dt;
+    state[POSE_Y] += v * c * dt;
+    state[POSE_HEADING] = wrapAngle(state[POSE_HEADING] + rate * dt);
+    state[POSE_SPEED] += (commandedSpeed - v) * alpha;
+    
+    // Jacobienne F = I + termes non nuls ci-dessous
+    float fxh = v * c * dt * DEG_TO_RAD_F;
+    float fxv = s * dt;
+    float fyh = -v * s * dt * DEG_TO_RAD_F;
+    float fyv = c * dt;
+    float fvv = 1.0f - alpha;
+    
+    // P = F P Fᵀ : d'abord F P (lignes), puis (F P) Fᵀ (colonnes)
+    float FP[POSE_STATE_COUNT][POSE_STATE_COUNT];
+    for (uint8_t j = 0; j < POSE_STATE_COUNT; j++) {
+        FP[POSE_X][j] = P[POSE_X][j] + fxh * P[POSE_HEADING][j] + fxv * P[POSE_SPEED][j];
+        FP[POSE_Y][j] = P[POSE_Y][j] + fyh * P[POSE_HEADING][j] + fyv * P[POSE_SPEED][j];
+        FP[POSE_HEADING][j] = P[POSE_HEADING][j];
+        FP[POSE_SPEED][j] = fvv * P[POSE_SPEED][j];
+    }
+    for (uint8_t i = 0; i < POSE_STATE_COUNT; i++) {
+        P[i][POSE_X] = FP[i][POSE_X] + FP[i][POSE_HEADING] * fxh + FP[i][POSE_SPEED] * fxv;
+        P[i][POSE_Y] = FP[i][POSE_Y] + FP[i][POSE_HEADING] * fyh + FP[i][POSE_SPEED] * fyv;
+        P[i][POSE_HEADING] = FP[i][POSE_HEADING];
+        P[i][POSE_SPEED] = FP[i][POSE_SPEED] * fvv;
+    }
+    
+    // Bruit de processus (marche aléatoire)
+    P[POSE_X][POSE_X] += EKF_POSITION_NOISE * EKF_POSITION_NOISE * dt;
+    P[POSE_Y][POSE_Y] += EKF_POSITION_NOISE * EKF_POSITION_NOISE * dt;
+    P[POSE_HEADING][POSE_HEADING] += EKF_GYRO_NOISE * EKF_GYRO_NOISE * dt;
+    P[POSE_SPEED][POSE_SPEED] += EKF_ACCEL_NOISE * EKF_ACCEL_NOISE * dt;
+}
+
+void PoseEstimator::scalarUpdate(uint8_t index, float innovation, float variance) {
+    float s = P[index][index] + variance;
+    if (s <= 0.0f) return;
+    
+    float K[POSE_STATE_COUNT];
+    for (uint8_t i = 0; i < POSE_STATE_COUNT; i++) K[i] = P[i][index] / s;
+    
+    for (uint8_t i = 0; i < POSE_STATE_COUNT; i++) state[i] += K[i] * innovation;
+    state[POSE_HEADING] = wrapAngle(state[POSE_HEADING]);
+    
+    // P = (I - K H) P, avec H qui sélectionne la ligne index
+    float row[POSE_STATE_COUNT];
+    for (uint8_t j = 0; j < POSE_STATE_COUNT; j++) row[j] = P[index][j];
+    for (uint8_t i = 0; i < POSE_STATE_COUNT; i++) {
+        for (uint8_t j = 0; j < POSE_STATE_COUNT; j++) P[i][j] -= K[i] * row[j];
+    }
+}
+
+void PoseEstimator::updateGps(double lat, double lng, float accuracy, float groundSpeed, float course,
+                              int8_t direction) {
+    if (!positionValid) {
+        // Premier point : origine du repère local
+        frame.setOrigin(lat, lng);
+        state[POSE_X] = 0.0f;
+        state[POSE_Y] = 0.0f;
+        positionValid = true;
+    }
+    
+    float x, y;
+    frame.toLocal(lat, lng, x, y);
+    
+    if (accuracy < EKF_MIN_GPS_ACCURACY) accuracy = EKF_MIN_GPS_ACCURACY;
+    float positionVariance = accuracy * accuracy;
+    scalarUpdate(POSE_X, x - state[POSE_X], positionVariance);
+    scalarUpdate(POSE_Y, y - state[POSE_Y], positionVariance);
+    
+    // Vitesse GPS non signée : signe pris sur la consigne. À l'arrêt, une vitesse
+    // mesurée (robot poussé, multitrajet) ne dit rien du sens : pas de correction
+    if (direction != 0 || groundSpeed < EKF_STILL_MAX_SPEED) {
+        float speed = direction < 0 ? -groundSpeed : groundSpeed;
+        scalarUpdate(POSE_SPEED, speed - state[POSE_SPEED], EKF_GPS_SPEED_NOISE * EKF_GPS_SPEED_NOISE);
+    }
+    
+    // La route GPS n'indique le cap qu'en marche avant et à vitesse suffisante
+    if (direction > 0 && groundSpeed >= EKF_COURSE_MIN_SPEED) {
+        float innovation = wrapAngleDiff(course - state[POSE_HEADING]);
+        scalarUpdate(POSE_HEADING, innovation, EKF_GPS_COURSE_NOISE * EKF_GPS_COURSE_NOISE);
+    }
+    
+    gpsUpdates++;
+}
+
+Pose PoseEstimator::getPose() const {
+    Pose pose;
+    pose.x = state[POSE_X];
+    pose.y = state[POSE_Y];
+    pose.heading = state[POSE_HEADING];
+    pose.speed = state[POSE_SPEED];
+    pose.sigmaPosition = sqrtf(P[POSE_X][POSE_X] + P[POSE_Y][POSE_Y]);
+    pose.sigmaHeading = sqrtf(P[POSE_HEADING][POSE_HEADING]);
+    return pose;
+}
+
+void PoseEstimator::toLocal(double lat, double lng, float& x, float& y) const {
+    frame.toLocal(lat, lng, x, y);
+}
@@ -0,0 +1,61 @@
+#ifndef POSE_ESTIMATOR_H
+#define POSE_ESTIMATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "local_frame.h"
+
+// Indices de l'état
+enum PoseState {
+    POSE_X,         // Est (m)
+    POSE_Y,         // Nord (m)
+    POSE_HEADING,   // Cap (°, 0 = Nord, sens horaire)
+    POSE_SPEED,     // Vitesse longitudinale (m/s)
+    POSE_STATE_COUNT
+};
+
+struct Pose {
+    float x, y;
+    float heading;
+    float speed;
+    float sigmaPosition;   // Écart-type de position (m)
+    float sigmaHeading;    // Écart-type de cap (°)
+};
+
+// Filtre de Kalman étendu : prédiction à chaque échantillon gyroscope (vitesse de
+// rotation + vitesse commandée aux moteurs), correction à chaque point GPS
+// (position, vitesse, route). Les mesures sont appliquées une par une (H unitaire),
+// sans inversion de matrice.
+class PoseEstimator {
+private:
+    float state[POSE_STATE_COUNT];
+    float P[POSE_STATE_COUNT][POSE_STATE_COUNT];
+    LocalFrame frame;        // Origine : premier point GPS
+    bool positionValid;
+    uint32_t gpsUpdates;
+    
+    void scalarUpdate(uint8_t index, float innovation, float variance);
+    
+public:
+    PoseEstimator();
+    
+    void reset(float heading);
+    
+    // rate : vitesse de rotation (°/s), commandedSpeed : consigne moteurs (m/s)
+    void predict(float rate, float commandedSpeed, float dt);
+    
+    // Point GPS : position, précision horizontale (m), vitesse sol (m/s, non signée), route (°).
+    // direction : signe de la consigne (+1 avant, -1 arrière, 0 à l'arrêt)
+    void updateGps(double lat, double lng, float accuracy, float groundSpeed, float course,
+                   int8_t direction);
+    
+    bool isPositionValid() const { return positionValid; }
+    float getHeading() const { return state[POSE_HEADING]; }
+    Pose getPose() const;
+    uint32_t getGpsUpdateCount() const { return gpsUpdates; }
+    
+    // Position d'un point géographique dans le repère de l'estimateur
+    void toLocal(double lat, double lng, float& x, float& y) const;
+};
+
+#endif
@@ -0,0 +1,69 @@
+#include "pure_pursuit.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+static PathPoint interpolate(const PathPoint& a, const PathPoint& b, float t) {
+    PathPoint point = { a.x + t * (b.x - a.x), a.y + t * (b.y - a.y) };
+    return point;
+}
+
+float PurePursuit::distance(const PathPoint& a, const PathPoint& b) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+float PurePursuit::progress(const PathPoint& a, const PathPoint& b, const PathPoint& p) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float lengthSquared = dx * dx + dy * dy;
+    if (lengthSquared < 1e-6f) return 1.0f;
+    return ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared;
+}
+
+bool PurePursuit::legReached(const PathPoint& a, const PathPoint& b, const PathPoint& p,
+                             float arrivalRadius, bool lastLeg) {
+    if (distance(p, b) <= arrivalRadius) return true;
+    return !lastLeg && progress(a, b, p) >= 1.0f;
+}
+
+float PurePursuit::lookahead(float speed) {
+    float distance = speed * PURSUIT_LOOKAHEAD_TIME;
+    return distance > PURSUIT_MIN_LOOKAHEAD ? distance : PURSUIT_MIN_LOOKAHEAD;
+}
+
+bool PurePursuit::intersect(const PathPoint& a, const PathPoint& b, const PathPoint& p, float radius, float& t) {
+    // |a + t(b - a) - p|² = radius²
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float fx = a.x - p.x;
+    float fy = a.y - p.y;
+    float qa = dx * dx + dy * dy;
+    float qb = 2.0f * (fx * dx + fy * dy);
+    float qc = fx * fx + fy * fy - radius * radius;
+    if (qa < 1e-6f) return false;
+    
+    float discriminant = qb * qb - 4.0f * qa * qc;
+    if (discriminant < 0.0f) return false;
+    
+    t = (-qb + sqrtf(discriminant)) / (2.0f * qa);
+    return t >= 0.0f && t <= 1.0f;
+}
+
+PathPoint PurePursuit::goal(const PathPoint& a, const PathPoint& b, const PathPoint* next,
+                            const PathPoint& p, float lookahead) {
+    float t;
+    if (next != NULL && intersect(b, *next, p, lookahead, t)) return interpolate(b, *next, t);
+    if (intersect(a, b, p, lookahead, t)) return interpolate(a, b, t);
+    
+    // Fin du trajet dans le cercle de visée : on vise le dernier point
+    if (distance(p, b) <= lookahead) return next != NULL ? *next : b;
+    
+    // Trop loin du trajet pour le croiser : on rejoint sa projection
+    float s = progress(a, b, p);
+    if (s < 0.0f) s = 0.0f;
+    if (s > 1.0f) s = 1.0f;
+    return interpolate(a, b, s);
+}
@@ -0,0 +1,37 @@
+#ifndef PURE_PURSUIT_H
+#define PURE_PURSUIT_H
+
+// Point du plan local (m, Est/Nord)
+struct PathPoint {
+    float x, y;
+};
+
+// Suivi de trajet par poursuite pure : le robot vise le point du trajet situé
+// à la distance de visée, le plus loin possible le long de [a, b] puis [b, next].
+// Le point de visée passe sur le segment suivant avant d'atteindre b : le robot
+// coupe le virage au lieu de s'arrêter sur le point intermédiaire.
+class PurePursuit {
+private:
+    // Plus grande intersection du cercle (p, radius) avec [a, b] : t dans [0, 1]
+    static bool intersect(const PathPoint& a, const PathPoint& b, const PathPoint& p, float radius, float& t);
+    
+public:
+    // Avancement de p le long de [a, b] : 0 en a, 1 en b (non borné)
+    static float progress(const PathPoint& a, const PathPoint& b, const PathPoint& p);
+    
+    // next : segment suivant [b, next] ou NULL pour le dernier point
+    static PathPoint goal(const PathPoint& a, const PathPoint& b, const PathPoint* next,
+                          const PathPoint& p, float lookahead);
+    
+    static float distance(const PathPoint& a, const PathPoint& b);
+    
+    // Tronçon [a, b] terminé : b au rayon d'arrivée, ou dépassé s'il n'est pas le dernier
+    // (le suivant enchaîne sans arrêt ; le dernier point doit être atteint)
+    static bool legReached(const PathPoint& a, const PathPoint& b, const PathPoint& p,
+                           float arrivalRadius, bool lastLeg);
+    
+    // Distance de visée croissante avec la vitesse du tronçon (m/s)
+    static float lookahead(float speed);
+};
+
+#endif
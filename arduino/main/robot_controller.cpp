@@ -1,14 +1,22 @@
 #include "robot_controller.h"
-#include <Wire.h>
+#include "logger.h"
 
 RobotController::RobotController() 
     : distanceSensor(TRIG_PIN, ECHO_PIN),
       servoScanner(SERVO_PIN, &distanceSensor),
       motorController(PWMA, PWMB, AIN, BIN, STBY),
       obstacleDetected(false),
+      lastFrontReading(0),
+      i2cBus(i2cBackend),
       gpsHandler(),
-      mpuHandler(),
-      navigationController(&gpsHandler, &mpuHandler, &motorController) {
+      mpuHandler(i2cBus),
+      poseEstimator(),
+      lastGpsFix(0),
+      navigationController(&gpsHandler, &mpuHandler, &motorController, &poseEstimator),
+      scheduler(NULL),
+      pendingMovement(MOVE_NONE),
+      pendingLeft(false),
+      lateralStatus(LATERAL_IDLE) {
     // Corps du constructeur
 }
 
@@ -16,7 +24,7 @@ void RobotController::init() {
     Serial.begin(SERIAL_BAUD);
     Serial.println("=== Robot MMA v6.0 COMPLET (Obstacles + GPS) ===");
     
-    Wire.begin(); // Initialiser I2C pour MPU-6500
+    i2cBackend.begin(); // I2C à 400 kHz pour MPU-6500
     pinMode(LED_BUILTIN, OUTPUT);
     
     // Initialisation des composants évitement d'obstacles
@@ -30,203 +38,436 @@ void RobotController::init() {
     // Initialisation des composants navigation GPS
     gpsHandler.init();
     mpuHandler.init();
+    poseEstimator.reset(mpuHandler.getRobotAngle());
     navigationController.init();
     
+    // Commande absente = commande silencieusement inconnue : signalé dès le démarrage
+    if (!registerCommands()) {
+        Serial.println("❌ Registre de commandes incomplet (plein ou identifiant en double)");
+    }
+    
     Serial.println("✅ Robot complet initialisé !");
     Serial.println("MODES DISPONIBLES:");
     Serial.println("- Évitement d'obstacles: z,s,q,d,x,i,r");
-    Serial.println("- Navigation GPS: set, go, stop, status, etc.");
+    Serial.println("- Navigation GPS: set, add, route, clear, go, stop, status, etc.");
+    Serial.println("- Performances: tasks, perf, perf_reset");
     Serial.println("==========================================");
 }
 
-void RobotController::update() {
+void RobotController::registerTasks(TaskScheduler& taskScheduler) {
+    scheduler = &taskScheduler;
+    
+    // Ordre d'enregistrement = priorité : le bus I2C et le gyroscope passent en premier
+    scheduler->addTask("i2c", TASK_PERIOD_I2C, i2cTask, this);
+    scheduler->addTask("gyro", TASK_PERIOD_GYRO, gyroTask, this);
+    scheduler->addTask("motor", TASK_PERIOD_MOTOR, motorTask, this);
+    scheduler->addTask("gps", TASK_PERIOD_GPS, gpsTask, this);
+    scheduler->addTask("servo", TASK_PERIOD_SERVO, servoTask, this);
+    scheduler->addTask("ultrasonic", TASK_PERIOD_ULTRASONIC, obstacleTask, this);
+    scheduler->addTask("navigation", TASK_PERIOD_NAVIGATION, navigationTask, this);
+    scheduler->addTask("serial", TASK_PERIOD_SERIAL, serialTask, this);
+}
+
+// === ÉTAPES DE MISE À JOUR ===
+
+void RobotController::updateI2C() {
+    i2cBus.poll(I2C_TRANSACTIONS_PER_TICK);
+}
+
+void RobotController::updateMotors() {
     motorController.checkRotationTimeout();
+}
+
+void RobotController::updateGyro() {
+    ProfileScope scope(profiler, PROFILE_GYRO);
+    // Moteurs arrêtés : fenêtres candidates pour le suivi du biais
+    mpuHandler.setStationary(motorController.isStopped());
+    
+    // Prédiction de pose à chaque échantillon (sans gyroscope : cap figé, vitesse suivie)
+    if (mpuHandler.update()) {
+        poseEstimator.predict(mpuHandler.getLastRate(), motorController.getCommandedSpeed(), mpuHandler.getLastDt());
+    } else if (!mpuHandler.isGyroOK()) {
+        poseEstimator.predict(0.0, motorController.getCommandedSpeed(), TASK_PERIOD_GYRO / 1000000.0);
+    }
+}
+
+void RobotController::updateGPS() {
+    ProfileScope scope(profiler, PROFILE_GPS);
+    gpsHandler.update();
     
-    // === MISE À JOUR CAPTEURS ===
+    // Correction de la pose à chaque nouveau point
+    if (gpsHandler.getFixCount() != lastGpsFix) {
+        lastGpsFix = gpsHandler.getFixCount();
+        float command = motorController.getCommandedSpeed();
+        poseEstimator.updateGps(gpsHandler.getCurrentLatitude(), gpsHandler.getCurrentLongitude(),
+                                gpsHandler.getHorizontalAccuracy(), gpsHandler.getGroundSpeed(),
+                                gpsHandler.getCourse(), command > 0.0 ? 1 : (command < 0.0 ? -1 : 0));
+    }
+}
+
+void RobotController::updateServo() {
+    ProfileScope scope(profiler, PROFILE_SERVO);
+    servoScanner.update();
+}
+
+void RobotController::updateObstacles() {
+    ProfileScope scope(profiler, PROFILE_ULTRASONIC);
     
-    // Capteur de distance pour évitement d'obstacles
-    if (distanceSensor.updateDistance()) {
+    // Capteur de distance pour évitement d'obstacles (ignoré pendant un balayage latéral)
+    if (!servoScanner.isBusy() && distanceSensor.updateDistance()) {
+        lastFrontReading = millis();
         bool wasObstacle = obstacleDetected;
         obstacleDetected = distanceSensor.isObstacleDetected();
         
         if (obstacleDetected != wasObstacle) {
-            Serial.print(">>> CHANGEMENT: ");
-            Serial.println(obstacleDetected ? "🚨 OBSTACLE DÉTECTÉ" : "✅ VOIE LIBRE");
+            logEvent<LOG_ROBOT, LOG_LEVEL_INFO>(EVT_OBSTACLE, obstacleDetected);
         }
     }
     
-    // GPS et gyroscope pour navigation
-    gpsHandler.update();
-    mpuHandler.update();
-    
-    // === SÉCURITÉS ===
-    
     // Arrêt sécurité obstacle (seulement si pas en navigation GPS)
     if (obstacleDetected && !motorController.getIsRotating() && !navigationController.isNavigating()) {
-        Serial.println("🛑 ARRÊT SÉCURITÉ - Obstacle détecté");
+        logEvent<LOG_ROBOT, LOG_LEVEL_WARN>(EVT_SAFETY_STOP, (int32_t)(distanceSensor.getLastValidDistance() * 10));
         motorController.stop();
     }
     
-    // === NAVIGATION GPS ===
+    // Pendant un balayage, l'avant n'est plus mesuré : pas de marche avant sur une mesure périmée
+    if (servoScanner.isBusy() && millis() - lastFrontReading > FRONT_READING_MAX_AGE &&
+        motorController.getCommandedSpeed() > 0.0 && !motorController.getIsRotating()) {
+        logText<LOG_ROBOT, LOG_LEVEL_INFO>("Arrêt pendant le balayage (mesure frontale périmée)");
+        motorController.stop();
+    }
+}
+
+void RobotController::updateNavigation() {
+    ProfileScope scope(profiler, PROFILE_NAVIGATION);
     navigationController.update();
 }
 
-bool RobotController::processMovementCommand(String cmd) {
-    return checkMovementSafety(cmd);
+void RobotController::i2cTask(void* context) {
+    static_cast<RobotController*>(context)->updateI2C();
+}
+
+void RobotController::motorTask(void* context) {
+    static_cast<RobotController*>(context)->updateMotors();
+}
+
+void RobotController::gyroTask(void* context) {
+    static_cast<RobotController*>(context)->updateGyro();
+}
+
+void RobotController::gpsTask(void* context) {
+    static_cast<RobotController*>(context)->updateGPS();
+}
+
+void RobotController::servoTask(void* context) {
+    static_cast<RobotController*>(context)->updateServo();
+}
+
+void RobotController::obstacleTask(void* context) {
+    static_cast<RobotController*>(context)->updateObstacles();
+}
+
+void RobotController::navigationTask(void* context) {
+    static_cast<RobotController*>(context)->updateNavigation();
+}
+
+void RobotController::serialTask(void* context) {
+    static_cast<RobotController*>(context)->handleSerialCommand();
+}
+
+// === COMMANDES ===
+
+// Rangés dans l'ordre de Movement : accès direct par MOVEMENTS[movement - MOVE_STOP]
+static constexpr MovementEntry MOVEMENTS[] = {
+    { commandId("stop"),           commandId("x"), MOVE_STOP,           false,  0 },
+    { commandId("forward"),        commandId("z"), MOVE_FORWARD,        true,   0 },
+    { commandId("backward"),       commandId("s"), MOVE_BACKWARD,       false,  0 },
+    { commandId("left"),           commandId("q"), MOVE_LEFT,           false, -1 },
+    { commandId("right"),          commandId("d"), MOVE_RIGHT,          false,  1 },
+    { commandId("forward_left"),   0,              MOVE_FORWARD_LEFT,   true,  -1 },
+    { commandId("forward_right"),  0,              MOVE_FORWARD_RIGHT,  true,   1 },
+    { commandId("backward_left"),  0,              MOVE_BACKWARD_LEFT,  false, -1 },
+    { commandId("backward_right"), 0,              MOVE_BACKWARD_RIGHT, false,  1 }
+};
+
+static constexpr uint8_t MOVEMENT_COUNT = sizeof(MOVEMENTS) / sizeof(MOVEMENTS[0]);
+
+static const uint32_t ROBOT_COMMANDS[] = {
+    commandId("i"), commandId("r"), commandId("tasks"), commandId("perf"), commandId("perf_reset")
+};
+
+static constexpr uint8_t ROBOT_COMMAND_COUNT = sizeof(ROBOT_COMMANDS) / sizeof(ROBOT_COMMANDS[0]);
+
+static constexpr bool movementsOrdered(uint8_t i = 0) {
+    return i >= MOVEMENT_COUNT || (MOVEMENTS[i].movement == MOVE_STOP + i && movementsOrdered(i + 1));
+}
+
+static constexpr uint8_t movementAliasCount(uint8_t i = 0) {
+    return i >= MOVEMENT_COUNT ? 0 : (MOVEMENTS[i].aliasId != 0) + movementAliasCount(i + 1);
+}
+
+static_assert(movementsOrdered(), "MOVEMENTS doit suivre l'ordre de Movement");
+static_assert(MOVEMENT_COUNT + movementAliasCount() + ROBOT_COMMAND_COUNT + NAVIGATION_COMMAND_COUNT <= MAX_COMMANDS,
+              "MAX_COMMANDS trop petit pour toutes les commandes");
+
+static const MovementEntry& movementEntry(Movement movement) {
+    return MOVEMENTS[movement - MOVE_STOP];
 }
 
-bool RobotController::checkMovementSafety(String cmd) {
-    bool blocked = false;
+bool RobotController::registerCommands() {
+    bool ok = true;
     
-    // Vérification obstacle frontal
-    if (cmd.indexOf("forward") != -1 && obstacleDetected) {
-        blocked = true;
+    // Mouvements : accessibles en série et en WiFi, alias d'un caractère en série
+    for (uint8_t i = 0; i < MOVEMENT_COUNT; i++) {
+        ok &= commands.add(MOVEMENTS[i].id, commandHandler, this, CMD_SOURCE_ANY);
+        if (MOVEMENTS[i].aliasId) {
+            ok &= commands.add(MOVEMENTS[i].aliasId, commandHandler, this, CMD_SOURCE_SERIAL);
+        }
     }
     
-    // Scan automatique pour les mouvements latéraux
-    if (cmd == "left" || cmd == "forward_left" || cmd == "backward_left") {
-        Serial.println("🔍 SCAN GAUCHE automatique...");
-        if (!servoScanner.checkLeftSafe(OBSTACLE_DISTANCE_CM)) {
-            Serial.println("❌ MOUVEMENT GAUCHE BLOQUÉ - Obstacle détecté !");
-            blocked = true;
+    for (uint8_t i = 0; i < ROBOT_COMMAND_COUNT; i++) {
+        ok &= commands.add(ROBOT_COMMANDS[i], commandHandler, this);
+    }
+    
+    ok &= navigationController.registerCommands(commands);
+    return ok;
+}
+
+CommandResult RobotController::commandHandler(void* target, const CommandRequest& request) {
+    RobotController* robot = static_cast<RobotController*>(target);
+    
+    switch (request.id) {
+        case commandId("i"):
+            robot->printInfo();
+            return CMD_OK;
+        case commandId("r"):
+            return robot->startFullScan();
+        case commandId("tasks"):
+            if (robot->scheduler) robot->scheduler->printStats();
+            return CMD_OK;
+        case commandId("perf"):
+            robot->profiler.printReport();
+            return CMD_OK;
+        case commandId("perf_reset"):
+            robot->profiler.reset();
+            if (robot->scheduler) robot->scheduler->resetStats();
+            Serial.println("✅ Statistiques remises à zéro");
+            return CMD_OK;
+        
+        // Mouvements : noms et alias de MOVEMENTS, entrée retrouvée par index direct
+        case commandId("stop"):
+        case commandId("x"):
+            return robot->handleMovement(movementEntry(MOVE_STOP), request.source);
+        case commandId("forward"):
+        case commandId("z"):
+            return robot->handleMovement(movementEntry(MOVE_FORWARD), request.source);
+        case commandId("backward"):
+        case commandId("s"):
+            return robot->handleMovement(movementEntry(MOVE_BACKWARD), request.source);
+        case commandId("left"):
+        case commandId("q"):
+            return robot->handleMovement(movementEntry(MOVE_LEFT), request.source);
+        case commandId("right"):
+        case commandId("d"):
+            return robot->handleMovement(movementEntry(MOVE_RIGHT), request.source);
+        case commandId("forward_left"):
+            return robot->handleMovement(movementEntry(MOVE_FORWARD_LEFT), request.source);
+        case commandId("forward_right"):
+            return robot->handleMovement(movementEntry(MOVE_FORWARD_RIGHT), request.source);
+        case commandId("backward_left"):
+            return robot->handleMovement(movementEntry(MOVE_BACKWARD_LEFT), request.source);
+        case commandId("backward_right"):
+            return robot->handleMovement(movementEntry(MOVE_BACKWARD_RIGHT), request.source);
+    }
+    return CMD_UNKNOWN;
+}
+
+CommandResult RobotController::executeCommand(uint32_t id, const char* args, CommandSource source) {
+    return commands.dispatch(id, args, source);
+}
+
+CommandResult RobotController::handleMovement(const MovementEntry& entry, CommandSource source) {
+    if (entry.movement == MOVE_STOP) {
+        cancelPendingMovement();
+        motorController.stop();
+        // En série, "stop"/"x" interrompt aussi la navigation GPS
+        if (source == CMD_SOURCE_SERIAL && navigationController.isNavigating()) {
+            navigationController.stopNavigation();
         }
-        servoScanner.returnToCenter();
+        return CMD_OK;
     }
-    else if (cmd == "right" || cmd == "forward_right" || cmd == "backward_right") {
-        Serial.println("🔍 SCAN DROITE automatique...");
-        if (!servoScanner.checkRightSafe(OBSTACLE_DISTANCE_CM)) {
-            Serial.println("❌ MOUVEMENT DROITE BLOQUÉ - Obstacle détecté !");
-            blocked = true;
+    
+    // Mouvements manuels interdits pendant la navigation GPS
+    if (navigationController.isNavigating()) {
+        logText<LOG_ROBOT, LOG_LEVEL_INFO>("Mouvement bloqué (navigation GPS active)");
+        return CMD_BLOCKED;
+    }
+    
+    // Vérification obstacle frontal
+    if (entry.forward && obstacleDetected) {
+        cancelPendingMovement();
+        return CMD_BLOCKED;
+    }
+    
+    // Scan automatique (non bloquant) pour les mouvements latéraux
+    if (entry.side != 0) {
+        return requestLateralMovement(entry.movement, entry.side < 0);
+    }
+    
+    // Toute autre commande annule un mouvement latéral en attente
+    cancelPendingMovement();
+    lateralStatus = LATERAL_IDLE;
+    executeMovement(entry.movement);
+    return CMD_OK;
+}
+
+CommandResult RobotController::requestLateralMovement(Movement movement, bool left) {
+    int angle = left ? SERVO_LEFT : SERVO_RIGHT;
+    
+    // Mesure latérale récente : décision immédiate
+    float distance = servoScanner.getDistanceAt(angle);
+    if (distance >= 0) {
+        if (distance > OBSTACLE_DISTANCE_CM) {
+            executeMovement(movement);
+            lateralStatus = LATERAL_DONE;
+            return CMD_OK;
         }
-        servoScanner.returnToCenter();
+        logText<LOG_ROBOT, LOG_LEVEL_INFO>(left ? "Mouvement gauche bloqué (obstacle)"
+                                                : "Mouvement droite bloqué (obstacle)");
+        lateralStatus = LATERAL_BLOCKED;
+        return CMD_BLOCKED;
+    }
+    
+    // Scan du même côté déjà en cours : on remplace simplement la commande en attente
+    if (pendingMovement != MOVE_NONE && pendingLeft == left) {
+        pendingMovement = movement;
+        return CMD_PENDING;
     }
     
-    if (!blocked) {
-        executeMovement(cmd);
+    cancelPendingMovement();
+    if (!servoScanner.startSweep(&angle, 1, lateralScanComplete, this)) {
+        logText<LOG_ROBOT, LOG_LEVEL_INFO>("Scan servo déjà en cours");
+        lateralStatus = LATERAL_BLOCKED;
+        return CMD_BLOCKED;
     }
     
-    return blocked;
+    logText<LOG_ROBOT, LOG_LEVEL_INFO>(left ? "Scan gauche automatique" : "Scan droite automatique");
+    pendingMovement = movement;
+    pendingLeft = left;
+    lateralStatus = LATERAL_SCANNING;
+    return CMD_PENDING;
 }
 
-void RobotController::executeMovement(String cmd) {
-    if (cmd == "forward") motorController.forward();
-    else if (cmd == "backward") motorController.backward();
-    else if (cmd == "left") motorController.rotateLeft90();
-    else if (cmd == "right") motorController.rotateRight90();
-    else if (cmd == "forward_right") motorController.forwardRight();
-    else if (cmd == "forward_left") motorController.forwardLeft();
-    else if (cmd == "backward_right") motorController.backwardRight();
-    else if (cmd == "backward_left") motorController.backwardLeft();
-    else if (cmd == "stop") motorController.stop();
+void RobotController::cancelPendingMovement() {
+    if (pendingMovement == MOVE_NONE) return;
+    pendingMovement = MOVE_NONE;
+    lateralStatus = LATERAL_IDLE;
+    servoScanner.cancelSweep();
 }
 
-void RobotController::handleSerialCommand() {
-    if (!Serial.available()) return;
+void RobotController::lateralScanComplete(void* context, const ServoScanner& scanner) {
+    RobotController* robot = static_cast<RobotController*>(context);
+    if (robot->pendingMovement == MOVE_NONE) return;
     
-    String input = Serial.readStringUntil('\n');
-    input.trim();
+    Movement movement = robot->pendingMovement;
+    robot->pendingMovement = MOVE_NONE;
     
-    // === COMMANDES NAVIGATION GPS (multi-caractères) ===
-    if (input.length() > 1) {
-        navigationController.handleCommands();
-        return;
+    float distance = scanner.getDistanceAt(robot->pendingLeft ? SERVO_LEFT : SERVO_RIGHT);
+    if (distance > OBSTACLE_DISTANCE_CM && !robot->navigationController.isNavigating()) {
+        robot->executeMovement(movement);
+        robot->lateralStatus = LATERAL_DONE;
+    } else {
+        // Issue différée : lisible par /status ("lateral") et dans les acquittements UDP
+        logText<LOG_ROBOT, LOG_LEVEL_INFO>("Mouvement latéral bloqué après scan");
+        robot->lateralStatus = LATERAL_BLOCKED;
     }
+}
+
+void RobotController::fullScanComplete(void* context, const ServoScanner& scanner) {
+    Serial.println("✅ Scan 180° terminé:");
+    scanner.printResults();
+}
+
+void RobotController::executeMovement(Movement movement) {
+    switch (movement) {
+        case MOVE_FORWARD:        motorController.forward(); break;
+        case MOVE_BACKWARD:       motorController.backward(); break;
+        case MOVE_LEFT:           motorController.rotateLeft90(); break;
+        case MOVE_RIGHT:          motorController.rotateRight90(); break;
+        case MOVE_FORWARD_RIGHT:  motorController.forwardRight(); break;
+        case MOVE_FORWARD_LEFT:   motorController.forwardLeft(); break;
+        case MOVE_BACKWARD_RIGHT: motorController.backwardRight(); break;
+        case MOVE_BACKWARD_LEFT:  motorController.backwardLeft(); break;
+        case MOVE_STOP:           motorController.stop(); break;
+        case MOVE_NONE:           break;
+    }
+}
+
+CommandResult RobotController::startFullScan() {
+    if (navigationController.isNavigating()) {
+        Serial.println(" -> SCAN BLOQUÉ (navigation GPS active)");
+        return CMD_BLOCKED;
+    }
+    if (servoScanner.isBusy()) {
+        Serial.println(" -> SCAN DÉJÀ EN COURS");
+        return CMD_BLOCKED;
+    }
+    servoScanner.fullScan(fullScanComplete, this);
+    return CMD_OK;
+}
+
+void RobotController::printInfo() {
+    Serial.print("INFO: Distance ");
+    Serial.print(distanceSensor.getLastValidDistance()); 
+    Serial.print("cm");
+    if (gpsHandler.isPositionValid()) {
+        Serial.print(" | GPS: ");
+        Serial.print(gpsHandler.getCurrentLatitude(), 6);
+        Serial.print(",");
+        Serial.print(gpsHandler.getCurrentLongitude(), 6);
+    }
+    Serial.print(" | I2C: ");
+    Serial.print(i2cBus.getCompleted());
+    Serial.print(" ok, ");
+    Serial.print(i2cBus.getErrors());
+    Serial.print(" erreurs, ");
+    Serial.print(i2cBus.getRejected());
+    Serial.print(" refusées");
+    Serial.print(" | GPS octets: ");
+    Serial.print(gpsHandler.getBytesReceived());
+    Serial.print(" débordements: ");
+    Serial.print(gpsHandler.getOverflowCount());
+    Serial.print(" erreurs: ");
+    Serial.print(gpsHandler.getFailedSentences());
+    Serial.println();
+}
+
+void RobotController::handleSerialCommand() {
+    // Lecture octet par octet, bornée par passage : une saisie partielle ne bloque rien
+    uint8_t budget = SERIAL_BYTES_PER_TICK;
+    while (budget-- > 0 && Serial.available() > 0) {
+        if (serialLine.feed((char)Serial.read())) {
+            handleSerialLine(serialLine.line());
+        }
+    }
+}
+
+void RobotController::handleSerialLine(char* line) {
+    if (line[0] == '\0') return;
     
-    // === COMMANDES ÉVITEMENT D'OBSTACLES (caractère unique) ===
-    char cmd = input.charAt(0);
-    bool blocked = false;
-    
-    Serial.print("💻 COMMANDE SÉRIE: ");
-    Serial.print(cmd);
+    CommandResult result = commands.dispatch(line, CMD_SOURCE_SERIAL);
     
-    switch (cmd) {
-        case 'z':
-            if (!obstacleDetected && !navigationController.isNavigating()) {
-                Serial.println(" -> FORWARD autorisé");
-                motorController.forward();
-            } else {
-                Serial.println(" -> FORWARD BLOQUÉ");
-                blocked = true;
-            }
-            break;
-        case 's': 
-            if (!navigationController.isNavigating()) {
-                Serial.println(" -> BACKWARD");
-                motorController.backward();
-            } else {
-                Serial.println(" -> BACKWARD BLOQUÉ (navigation GPS active)");
-                blocked = true;
-            }
-            break;
-        case 'q': 
-            if (!navigationController.isNavigating()) {
-                Serial.println(" -> LEFT avec scan...");
-                if (servoScanner.checkLeftSafe(OBSTACLE_DISTANCE_CM)) {
-                    servoScanner.returnToCenter();
-                    motorController.rotateLeft90();
-                } else {
-                    servoScanner.returnToCenter();
-                    Serial.println("❌ ROTATION GAUCHE BLOQUÉE");
-                    blocked = true;
-                }
-            } else {
-                Serial.println(" -> LEFT BLOQUÉ (navigation GPS active)");
-                blocked = true;
-            }
-            break;
-        case 'd': 
-            if (!navigationController.isNavigating()) {
-                Serial.println(" -> RIGHT avec scan...");
-                if (servoScanner.checkRightSafe(OBSTACLE_DISTANCE_CM)) {
-                    servoScanner.returnToCenter();
-                    motorController.rotateRight90();
-                } else {
-                    servoScanner.returnToCenter();
-                    Serial.println("❌ ROTATION DROITE BLOQUÉE");
-                    blocked = true;
-                }
-            } else {
-                Serial.println(" -> RIGHT BLOQUÉ (navigation GPS active)");
-                blocked = true;
-            }
-            break;
-        case 'x': 
-            Serial.println(" -> STOP");
-            motorController.stop();
-            if (navigationController.isNavigating()) {
-                navigationController.stopNavigation();
-                Serial.println("🛑 Navigation GPS arrêtée");
-            }
-            break;
-        case 'i':
-            Serial.print(" -> INFO: Distance ");
-            Serial.print(distanceSensor.getLastValidDistance()); 
-            Serial.print("cm");
-            if (gpsHandler.isPositionValid()) {
-                Serial.print(" | GPS: ");
-                Serial.print(gpsHandler.getCurrentLatitude(), 6);
-                Serial.print(",");
-                Serial.print(gpsHandler.getCurrentLongitude(), 6);
-            }
-            Serial.println();
-            break;
-        case 'r':
-            if (!navigationController.isNavigating()) {
-                servoScanner.fullScan();
-            } else {
-                Serial.println(" -> SCAN BLOQUÉ (navigation GPS active)");
-                blocked = true;
-            }
-            break;
-        default:
-            Serial.println(" -> INCONNUE");
-            Serial.println("💡 Commandes disponibles:");
-            Serial.println("   z,s,q,d,x,i,r - Contrôle robot");
-            Serial.println("   set, go, stop, status... - Navigation GPS");
-            break;
+    if (result == CMD_BLOCKED) {
+        Serial.println("❌ COMMANDE BLOQUÉE PAR SÉCURITÉ");
+    } else if (result == CMD_PENDING) {
+        Serial.println("⏳ Scan latéral en cours, mouvement différé");
+    } else if (result == CMD_UNKNOWN) {
+        Serial.println("❓ Commande inconnue");
+        Serial.println("💡 Commandes disponibles:");
+        Serial.println("   z,s,q,d,x,i,r - Contrôle robot");
+        Serial.println("   set, add, route, clear, go, stop, status... - Navigation GPS");
+        Serial.println("   tasks, perf, perf_reset - Performances");
     }
-    
-    if (blocked) Serial.println("❌ COMMANDE BLOQUÉE PAR SÉCURITÉ");
 }
 
 float RobotController::getDistance() const {
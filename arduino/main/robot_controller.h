@@ -9,6 +9,43 @@
 #include "gps_handler.h"
 #include "mpu6500_handler.h"
 #include "navigation_controller.h"
+#include "pose_estimator.h"
+#include "i2c_bus.h"
+#include "wire_backend.h"
+#include "task_scheduler.h"
+#include "loop_profiler.h"
+#include "command_registry.h"
+#include "line_assembler.h"
+
+enum Movement {
+    MOVE_NONE,
+    MOVE_STOP,
+    MOVE_FORWARD,
+    MOVE_BACKWARD,
+    MOVE_LEFT,
+    MOVE_RIGHT,
+    MOVE_FORWARD_LEFT,
+    MOVE_FORWARD_RIGHT,
+    MOVE_BACKWARD_LEFT,
+    MOVE_BACKWARD_RIGHT
+};
+
+// Commande de mouvement : nom complet, alias série d'un caractère, propriétés de sécurité
+struct MovementEntry {
+    uint32_t id;
+    uint32_t aliasId;
+    Movement movement;
+    bool forward;
+    int8_t side;   // -1 gauche, +1 droite, 0 aucun scan latéral
+};
+
+// Issue du dernier mouvement latéral (décision immédiate ou après scan servo)
+enum LateralStatus {
+    LATERAL_IDLE,
+    LATERAL_SCANNING,   // Scan en cours, mouvement différé
+    LATERAL_DONE,
+    LATERAL_BLOCKED
+};
 
 class RobotController {
 private:
@@ -17,27 +54,71 @@ private:
     ServoScanner servoScanner;
     MotorController motorController;
     bool obstacleDetected;
+    unsigned long lastFrontReading;   // millis() de la dernière mesure frontale (hors balayage)
+    
+    // Bus I2C partagé (file de transactions)
+    WireBackend i2cBackend;
+    I2cBus i2cBus;
     
     // Composants navigation GPS
     GPSHandler gpsHandler;
     MPU6500Handler mpuHandler;
+    PoseEstimator poseEstimator;
+    unsigned long lastGpsFix;   // Dernier point GPS transmis à l'estimateur
     NavigationController navigationController;
     
-   
+    TaskScheduler* scheduler;
+    LoopProfiler profiler;
+    CommandRegistry commands;
+    LineAssembler<COMMAND_MAX_LENGTH> serialLine;
+    
+    // Mouvement latéral en attente du résultat du scan servo
+    Movement pendingMovement;
+    bool pendingLeft;
+    LateralStatus lateralStatus;
+    
+    bool registerCommands();
+    static CommandResult commandHandler(void* target, const CommandRequest& request);
+    
+    CommandResult handleMovement(const MovementEntry& entry, CommandSource source);
+    void executeMovement(Movement movement);
+    CommandResult requestLateralMovement(Movement movement, bool left);
+    void cancelPendingMovement();
+    CommandResult startFullScan();
+    void printInfo();
+    static void lateralScanComplete(void* context, const ServoScanner& scanner);
+    static void fullScanComplete(void* context, const ServoScanner& scanner);
+    
+    // Étapes de mise à jour, cadencées par l'ordonnanceur
+    void updateI2C();
+    void updateMotors();
+    void updateGyro();
+    void updateGPS();
+    void updateServo();
+    void updateObstacles();
+    void updateNavigation();
     
-    void executeMovement(String cmd);
-    bool checkMovementSafety(String cmd);
+    static void i2cTask(void* context);
+    static void motorTask(void* context);
+    static void gyroTask(void* context);
+    static void gpsTask(void* context);
+    static void servoTask(void* context);
+    static void obstacleTask(void* context);
+    static void navigationTask(void* context);
+    static void serialTask(void* context);
     
 public:
     RobotController();
     void init();
-    void update();
+    void registerTasks(TaskScheduler& taskScheduler);
     void handleSerialCommand();
-    bool processMovementCommand(String cmd);
+    void handleSerialLine(char* line);
+    CommandResult executeCommand(uint32_t id, const char* args, CommandSource source);
     
     // Getters pour WiFi (obstacle avoidance)
     float getDistance() const;
     bool isObstacleDetected() const;
+    LateralStatus getLateralStatus() const { return lateralStatus; }
     
     // Getters pour navigation GPS
     bool isGPSValid() const;
@@ -55,8 +136,12 @@ public:
     ServoScanner& getServoScanner() { return servoScanner; }
     MotorController& getMotorController() { return motorController; }
     GPSHandler& getGPSHandler() { return gpsHandler; }
+    I2cBus& getI2cBus() { return i2cBus; }
     MPU6500Handler& getMPUHandler() { return mpuHandler; }
+    PoseEstimator& getPoseEstimator() { return poseEstimator; }
     NavigationController& getNavigationController() { return navigationController; }
+    LoopProfiler& getProfiler() { return profiler; }
+    CommandRegistry& getCommands() { return commands; }
 };
 
 #endif
\ No newline at end of file
@@ -1,7 +1,16 @@
 #include "servo_scanner.h"
+#include "logger.h"
 
 ServoScanner::ServoScanner(int pin, DistanceSensor* sensor) 
-    : servoPin(pin), currentAngle(SERVO_CENTER), distanceSensor(sensor) {
+    : servoPin(pin), currentAngle(SERVO_CENTER), distanceSensor(sensor),
+      sweepState(SWEEP_IDLE), sweepCount(0), sweepIndex(0), sweepReturnToCenter(true),
+      moveTime(0), settleTime(0), sweepCallback(NULL), sweepContext(NULL) {
+    for (uint8_t i = 0; i < MAX_SWEEP_POINTS; i++) {
+        results[i].angle = 0;
+        results[i].distance = INVALID_DISTANCE;
+        results[i].timestamp = 0;
+        results[i].valid = false;
+    }
 }
 
 void ServoScanner::init() {
@@ -19,10 +28,13 @@ void ServoScanner::testScan() {
         scanDirection(angle);
         delay(500);
     }
-    returnToCenter();
+    scanServo.write(SERVO_CENTER);
+    currentAngle = SERVO_CENTER;
+    delay(SERVO_DELAY);
     Serial.println("✅ Servo scanner opérationnel !");
 }
 
+// Mesure bloquante, réservée au test de démarrage
 float ServoScanner::scanDirection(int angle) {
     angle = constrain(angle, SERVO_MIN, SERVO_MAX);
     
@@ -35,6 +47,7 @@ float ServoScanner::scanDirection(int angle) {
     delay(SERVO_DELAY);
     
     float distance = distanceSensor->measureDistance();
+    storeResult(angle, distance);
     
     Serial.print(" Distance: ");
     Serial.print(distance);
@@ -43,52 +56,165 @@ float ServoScanner::scanDirection(int angle) {
     return distance;
 }
 
-bool ServoScanner::checkLeftSafe(float threshold) {
-    Serial.println("👈 Scan GAUCHE (150°)");
-    float leftDistance = scanDirection(SERVO_LEFT);
-    bool safe = (leftDistance > threshold);
-    
-    Serial.print("   Gauche ");
-    Serial.print(safe ? "✅ LIBRE" : "❌ BLOQUÉ");
-    Serial.print(" (");
-    Serial.print(leftDistance);
-    Serial.println(" cm)");
+void ServoScanner::returnToCenter() {
+    if (sweepState != SWEEP_IDLE) return;
+    if (currentAngle != SERVO_CENTER) {
+        logText<LOG_SERVO, LOG_LEVEL_DEBUG>("Retour au centre");
+        moveTo(SERVO_CENTER);
+        sweepState = SWEEP_RETURNING;
+    }
+}
+
+void ServoScanner::fullScan(SweepCallback callback, void* context) {
+    static const int FULL_SCAN_ANGLES[] = {30, 60, 90, 120, 150};
     
-    return safe;
+    Serial.println(" -> SCAN 180°");
+    startSweep(FULL_SCAN_ANGLES, sizeof(FULL_SCAN_ANGLES) / sizeof(FULL_SCAN_ANGLES[0]),
+               callback, context);
+}
+
+int ServoScanner::getCurrentAngle() const {
+    return currentAngle;
 }
 
-bool ServoScanner::checkRightSafe(float threshold) {
-    Serial.println("👉 Scan DROITE (30°)");
-    float rightDistance = scanDirection(SERVO_RIGHT);
-    bool safe = (rightDistance > threshold);
+// === BALAYAGE NON BLOQUANT ===
+
+bool ServoScanner::startSweep(const int* angles, uint8_t count, SweepCallback callback,
+                              void* context, bool returnCenter) {
+    if (sweepState != SWEEP_IDLE || count == 0) return false;
     
-    Serial.print("   Droite ");
-    Serial.print(safe ? "✅ LIBRE" : "❌ BLOQUÉ");
-    Serial.print(" (");
-    Serial.print(rightDistance);
-    Serial.println(" cm)");
+    sweepCount = min(count, MAX_SWEEP_POINTS);
+    for (uint8_t i = 0; i < sweepCount; i++) {
+        sweepAngles[i] = constrain(angles[i], SERVO_MIN, SERVO_MAX);
+    }
+    sweepIndex = 0;
+    sweepReturnToCenter = returnCenter;
+    sweepCallback = callback;
+    sweepContext = context;
     
-    return safe;
+    moveTo(sweepAngles[0]);
+    sweepState = SWEEP_SETTLING;
+    return true;
 }
 
-void ServoScanner::returnToCenter() {
+void ServoScanner::cancelSweep() {
+    if (sweepState == SWEEP_IDLE) return;
+    if (sweepState == SWEEP_MEASURING) distanceSensor->cancelMeasurement();
+    
+    sweepCallback = NULL;
+    sweepContext = NULL;
     if (currentAngle != SERVO_CENTER) {
-        Serial.println("🎯 Retour au centre (90°)");
-        scanServo.write(SERVO_CENTER);
-        currentAngle = SERVO_CENTER;
-        delay(SERVO_DELAY);
+        moveTo(SERVO_CENTER);
+        sweepState = SWEEP_RETURNING;
+    } else {
+        sweepState = SWEEP_IDLE;
     }
 }
 
-void ServoScanner::fullScan() {
-    Serial.println(" -> SCAN 180°");
-    for(int angle = SERVO_RIGHT; angle <= SERVO_LEFT; angle += 30) {
-        scanDirection(angle);
-        delay(300);
+void ServoScanner::update() {
+    if (sweepState == SWEEP_IDLE) return;
+    
+    if (sweepState == SWEEP_MEASURING) {
+        float distance;
+        if (!distanceSensor->pollMeasurement(distance)) return;
+        storeResult(currentAngle, distance);
+        nextAngle();
+        return;
     }
-    returnToCenter();
+    
+    if (millis() - moveTime < settleTime) return;
+    
+    if (sweepState == SWEEP_RETURNING) {
+        finishSweep();
+        return;
+    }
+    
+    // Servo stabilisé : déclenchement de la mesure, relevée aux passages suivants
+    distanceSensor->startMeasurement();
+    sweepState = SWEEP_MEASURING;
 }
 
-int ServoScanner::getCurrentAngle() const {
-    return currentAngle;
-}
\ No newline at end of file
+void ServoScanner::nextAngle() {
+    sweepIndex++;
+    
+    if (sweepIndex < sweepCount) {
+        moveTo(sweepAngles[sweepIndex]);
+        sweepState = SWEEP_SETTLING;
+    } else if (sweepReturnToCenter && currentAngle != SERVO_CENTER) {
+        moveTo(SERVO_CENTER);
+        sweepState = SWEEP_RETURNING;
+    } else {
+        finishSweep();
+    }
+}
+
+bool ServoScanner::isBusy() const {
+    return sweepState != SWEEP_IDLE;
+}
+
+void ServoScanner::moveTo(int angle) {
+    // Temps de stabilisation proportionnel au débattement
+    unsigned long travel = abs(angle - currentAngle);
+    settleTime = SERVO_SETTLE_BASE_MS + travel * SERVO_SETTLE_PER_DEGREE_MS;
+    
+    scanServo.write(angle);
+    currentAngle = angle;
+    moveTime = millis();
+}
+
+void ServoScanner::storeResult(int angle, float distance) {
+    // Réutilise l'entrée de cet angle, sinon remplace la plus ancienne
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < MAX_SWEEP_POINTS; i++) {
+        if (results[i].valid && results[i].angle == angle) {
+            slot = i;
+            break;
+        }
+        if (!results[i].valid || results[i].timestamp < results[slot].timestamp) {
+            slot = i;
+            if (!results[i].valid) break;
+        }
+    }
+    
+    results[slot].angle = angle;
+    results[slot].distance = distance;
+    results[slot].timestamp = millis();
+    results[slot].valid = true;
+}
+
+void ServoScanner::finishSweep() {
+    sweepState = SWEEP_IDLE;
+    
+    SweepCallback callback = sweepCallback;
+    void* context = sweepContext;
+    sweepCallback = NULL;
+    sweepContext = NULL;
+    
+    if (callback) callback(context, *this);
+}
+
+float ServoScanner::getDistanceAt(int angle, unsigned long maxAge) const {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < MAX_SWEEP_POINTS; i++) {
+        if (results[i].valid && results[i].angle == angle) {
+            if (now - results[i].timestamp > maxAge) return -1.0;
+            return results[i].distance;
+        }
+    }
+    return -1.0;
+}
+
+const SweepResult& ServoScanner::getResult(uint8_t index) const {
+    return results[index];
+}
+
+void ServoScanner::printResults() const {
+    for (uint8_t i = 0; i < MAX_SWEEP_POINTS; i++) {
+        if (!results[i].valid) continue;
+        Serial.print("   ");
+        Serial.print(results[i].angle);
+        Serial.print("° -> ");
+        Serial.print(results[i].distance);
+        Serial.println(" cm");
+    }
+}
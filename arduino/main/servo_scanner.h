@@ -6,23 +6,72 @@
 #include "config.h"
 #include "distance_sensor.h"
 
+const uint8_t MAX_SWEEP_POINTS = 8;
+
+// Mesure retenue pour un angle donné
+struct SweepResult {
+    int angle;
+    float distance;
+    unsigned long timestamp;
+    bool valid;
+};
+
+enum SweepState {
+    SWEEP_IDLE,
+    SWEEP_SETTLING,   // Servo en mouvement vers l'angle à mesurer
+    SWEEP_MEASURING,  // Écho ultrason attendu
+    SWEEP_RETURNING   // Retour au centre après le dernier angle
+};
+
+class ServoScanner;
+typedef void (*SweepCallback)(void* context, const ServoScanner& scanner);
+
 class ServoScanner {
 private:
     Servo scanServo;
-    int currentAngle;
     int servoPin;
+    int currentAngle;
     DistanceSensor* distanceSensor;
     
+    // Balayage non bloquant
+    SweepState sweepState;
+    int sweepAngles[MAX_SWEEP_POINTS];
+    uint8_t sweepCount;
+    uint8_t sweepIndex;
+    bool sweepReturnToCenter;
+    unsigned long moveTime;
+    unsigned long settleTime;
+    SweepCallback sweepCallback;
+    void* sweepContext;
+    
+    // Table des dernières mesures par angle
+    SweepResult results[MAX_SWEEP_POINTS];
+    
+    void moveTo(int angle);
+    void storeResult(int angle, float distance);
+    void nextAngle();
+    void finishSweep();
+    
 public:
     ServoScanner(int pin, DistanceSensor* sensor);
     void init();
     void testScan();
     float scanDirection(int angle);
-    bool checkLeftSafe(float threshold = OBSTACLE_DISTANCE_CM);
-    bool checkRightSafe(float threshold = OBSTACLE_DISTANCE_CM);
     void returnToCenter();
-    void fullScan();
+    void fullScan(SweepCallback callback = NULL, void* context = NULL);
     int getCurrentAngle() const;
+    
+    // Balayage non bloquant : update() doit être appelé périodiquement
+    bool startSweep(const int* angles, uint8_t count, SweepCallback callback = NULL,
+                    void* context = NULL, bool returnCenter = true);
+    void cancelSweep();
+    void update();
+    bool isBusy() const;
+    
+    // Dernière mesure pour un angle, ou -1 si absente ou plus vieille que maxAge (ms)
+    float getDistanceAt(int angle, unsigned long maxAge = SCAN_RESULT_MAX_AGE) const;
+    const SweepResult& getResult(uint8_t index) const;
+    void printResults() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,112 @@
+#include "task_scheduler.h"
+
+TaskScheduler::TaskScheduler(ClockFunction clockFn)
+    : taskCount(0), clock(clockFn) {
+}
+
+int TaskScheduler::addTask(const char* name, unsigned long periodUs, TaskCallback callback, void* context) {
+    if (taskCount >= MAX_SCHEDULED_TASKS || callback == NULL) return -1;
+
+    Task& task = tasks[taskCount];
+    task.callback = callback;
+    task.context = context;
+    task.nextRun = clock();
+    task.enabled = true;
+    task.stats.name = name;
+    task.stats.periodUs = periodUs;
+    task.stats.runs = 0;
+    task.stats.lateRuns = 0;
+    task.stats.longRuns = 0;
+    task.stats.maxJitterUs = 0;
+    task.stats.lastDurationUs = 0;
+    task.stats.maxDurationUs = 0;
+
+    return taskCount++;
+}
+
+void TaskScheduler::setEnabled(int taskId, bool enabled) {
+    if (taskId < 0 || taskId >= taskCount) return;
+    if (enabled && !tasks[taskId].enabled) {
+        tasks[taskId].nextRun = clock();  // Pas de rattrapage après une pause
+    }
+    tasks[taskId].enabled = enabled;
+}
+
+void TaskScheduler::run() {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        Task& task = tasks[i];
+        if (!task.enabled) continue;
+
+        unsigned long now = clock();
+        // Comparaison signée pour supporter le débordement de micros()
+        if ((long)(now - task.nextRun) < 0) continue;
+
+        runTask(task, now);
+    }
+}
+
+void TaskScheduler::runTask(Task& task, unsigned long now) {
+    TaskStats& stats = task.stats;
+    unsigned long lateness = now - task.nextRun;
+
+    if (stats.periodUs > 0) {
+        if (lateness > stats.maxJitterUs) stats.maxJitterUs = lateness;
+
+        if (lateness >= stats.periodUs) {
+            // Au moins une échéance manquée : on se recale au lieu de rattraper en rafale
+            stats.lateRuns++;
+            task.nextRun = now + stats.periodUs;
+        } else {
+            task.nextRun += stats.periodUs;
+        }
+    } else {
+        task.nextRun = now;
+    }
+
+    task.callback(task.context);
+
+    unsigned long duration = clock() - now;
+    stats.lastDurationUs = duration;
+    if (duration > stats.maxDurationUs) stats.maxDurationUs = duration;
+    // Compté à part : le retard qu'elle provoque au départ suivant est un lateRun
+    if (stats.periodUs > 0 && duration > stats.periodUs) stats.longRuns++;
+    stats.runs++;
+}
+
+void TaskScheduler::resetStats() {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        TaskStats& stats = tasks[i].stats;
+        stats.runs = 0;
+        stats.lateRuns = 0;
+        stats.longRuns = 0;
+        stats.maxJitterUs = 0;
+        stats.lastDurationUs = 0;
+        stats.maxDurationUs = 0;
+    }
+}
+
+uint8_t TaskScheduler::getTaskCount() const {
+    return taskCount;
+}
+
+const TaskStats& TaskScheduler::getStats(uint8_t taskId) const {
+    return tasks[taskId].stats;
+}
+
+#ifdef ARDUINO
+void TaskScheduler::printStats() const {
+    Serial.println("=== TÂCHES ===");
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const TaskStats& stats = tasks[i].stats;
+        Serial.print(stats.name);
+        Serial.print(" | période: "); Serial.print(stats.periodUs);
+        Serial.print("µs | exécutions: "); Serial.print(stats.runs);
+        Serial.print(" | en retard: "); Serial.print(stats.lateRuns);
+        Serial.print(" | trop longues: "); Serial.print(stats.longRuns);
+        Serial.print(" | gigue max: "); Serial.print(stats.maxJitterUs);
+        Serial.print("µs | durée max: "); Serial.print(stats.maxDurationUs);
+        Serial.println("µs");
+    }
+    Serial.println("==============");
+}
+#endif
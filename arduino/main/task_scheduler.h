@@ -0,0 +1,65 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// Build hôte : l'horloge est fournie par le banc de test (fausse micros())
+#include <stdint.h>
+#include <stddef.h>
+unsigned long micros();
+#endif
+
+const uint8_t MAX_SCHEDULED_TASKS = 12;
+
+typedef void (*TaskCallback)(void* context);
+typedef unsigned long (*ClockFunction)();
+
+// Statistiques d'exécution d'une tâche (temps en µs)
+struct TaskStats {
+    const char* name;
+    unsigned long periodUs;
+    unsigned long runs;
+    unsigned long lateRuns;       // Départs avec au moins une échéance manquée (recalage)
+    unsigned long longRuns;       // Exécutions plus longues que la période
+    unsigned long maxJitterUs;    // Retard maximal par rapport à l'échéance
+    unsigned long lastDurationUs;
+    unsigned long maxDurationUs;
+};
+
+// Ordonnanceur coopératif à période fixe.
+// Les tâches sont exécutées dans l'ordre d'enregistrement (priorité décroissante)
+// dès que leur échéance est atteinte. Une période de 0 signifie "à chaque passage".
+class TaskScheduler {
+private:
+    struct Task {
+        TaskCallback callback;
+        void* context;
+        unsigned long nextRun;
+        bool enabled;
+        TaskStats stats;
+    };
+
+    Task tasks[MAX_SCHEDULED_TASKS];
+    uint8_t taskCount;
+    ClockFunction clock;
+
+    void runTask(Task& task, unsigned long now);
+
+public:
+    TaskScheduler(ClockFunction clockFn = micros);
+
+    // Retourne l'identifiant de la tâche, ou -1 si la table est pleine
+    int addTask(const char* name, unsigned long periodUs, TaskCallback callback, void* context);
+    void setEnabled(int taskId, bool enabled);
+    void run();
+    void resetStats();
+
+    uint8_t getTaskCount() const;
+    const TaskStats& getStats(uint8_t taskId) const;
+#ifdef ARDUINO
+    void printStats() const;
+#endif
+};
+
+#endif
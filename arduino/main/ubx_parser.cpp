@@ -0,0 +1,104 @@
+#include "ubx_parser.h"
+
+UbxParser::UbxParser()
+    : state(SYNC_1), msgClass(0), msgId(0), length(0), index(0), ckA(0), ckB(0),
+      frameCount(0), checksumErrors(0) {
+}
+
+bool UbxParser::keepPayload() const {
+    return msgClass == UBX_CLASS_NAV && msgId == UBX_NAV_PVT && length == UBX_NAV_PVT_LENGTH;
+}
+
+bool UbxParser::encode(uint8_t c) {
+    switch (state) {
+        case SYNC_1:
+            if (c == UBX_SYNC_1) state = SYNC_2;
+            return false;
+            
+        case SYNC_2:
+            state = (c == UBX_SYNC_2) ? CLASS : (c == UBX_SYNC_1 ? SYNC_2 : SYNC_1);
+            ckA = 0;
+            ckB = 0;
+            return false;
+            
+        case CLASS:
+            msgClass = c;
+            checksum(c);
+            state = ID;
+            return false;
+            
+        case ID:
+            msgId = c;
+            checksum(c);
+            state = LENGTH_1;
+            return false;
+            
+        case LENGTH_1:
+            length = c;
+            checksum(c);
+            state = LENGTH_2;
+            return false;
+            
+        case LENGTH_2:
+            length |= (uint16_t)c << 8;
+            checksum(c);
+            index = 0;
+            // Longueur aberrante (octets corrompus) : resynchronisation immédiate plutôt
+            // que d'avaler jusqu'à 64 Ko de flux, trames valides comprises
+            if (length > UBX_NAV_PVT_LENGTH) {
+                state = SYNC_1;
+                return false;
+            }
+            state = length > 0 ? PAYLOAD : CHECKSUM_A;
+            return false;
+            
+        case PAYLOAD:
+            // Les trames inconnues ne sont pas stockées, mais leur somme est vérifiée
+            if (keepPayload()) payload[index] = c;
+            checksum(c);
+            if (++index >= length) state = CHECKSUM_A;
+            return false;
+            
+        case CHECKSUM_A:
+            if (c != ckA) {
+                checksumErrors++;
+                state = SYNC_1;
+                return false;
+            }
+            state = CHECKSUM_B;
+            return false;
+            
+        case CHECKSUM_B:
+            state = SYNC_1;
+            if (c != ckB) {
+                checksumErrors++;
+                return false;
+            }
+            frameCount++;
+            return keepPayload();
+    }
+    return false;
+}
+
+size_t UbxParser::buildFrame(uint8_t msgClass, uint8_t msgId, const uint8_t* data, uint16_t dataLength,
+                             uint8_t* out, size_t outSize) {
+    size_t total = (size_t)dataLength + 8;
+    if (total > outSize) return 0;
+    
+    out[0] = UBX_SYNC_1;
+    out[1] = UBX_SYNC_2;
+    out[2] = msgClass;
+    out[3] = msgId;
+    out[4] = dataLength & 0xFF;
+    out[5] = dataLength >> 8;
+    for (uint16_t i = 0; i < dataLength; i++) out[6 + i] = data[i];
+    
+    uint8_t a = 0, b = 0;
+    for (size_t i = 2; i < total - 2; i++) {
+        a += out[i];
+        b += a;
+    }
+    out[total - 2] = a;
+    out[total - 1] = b;
+    return total;
+}
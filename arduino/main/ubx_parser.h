@@ -0,0 +1,91 @@
+#ifndef UBX_PARSER_H
+#define UBX_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t UBX_SYNC_1 = 0xB5;
+const uint8_t UBX_SYNC_2 = 0x62;
+const uint8_t UBX_CLASS_NAV = 0x01;
+const uint8_t UBX_CLASS_CFG = 0x06;
+const uint8_t UBX_NAV_PVT = 0x07;
+const uint8_t UBX_CFG_PRT = 0x00;
+const uint8_t UBX_CFG_MSG = 0x01;
+const uint8_t UBX_CFG_RATE = 0x08;
+const uint16_t UBX_NAV_PVT_LENGTH = 92;
+
+// Lecture des champs NAV-PVT directement dans la charge utile reçue (petit-boutiste).
+// La vue n'est valide que jusqu'au prochain octet donné au parseur.
+class UbxNavPvtView {
+private:
+    const uint8_t* payload;
+    
+    uint32_t u4(uint8_t offset) const {
+        return (uint32_t)payload[offset] | ((uint32_t)payload[offset + 1] << 8) |
+               ((uint32_t)payload[offset + 2] << 16) | ((uint32_t)payload[offset + 3] << 24);
+    }
+    int32_t i4(uint8_t offset) const { return (int32_t)u4(offset); }
+    
+public:
+    explicit UbxNavPvtView(const uint8_t* data) : payload(data) {}
+    
+    uint32_t iTOW() const { return u4(0); }          // Temps de la semaine GPS (ms)
+    uint8_t hour() const { return payload[8]; }
+    uint8_t minute() const { return payload[9]; }
+    uint8_t second() const { return payload[10]; }
+    uint8_t fixType() const { return payload[20]; }  // 2 = 2D, 3 = 3D
+    bool gnssFixOK() const { return (payload[21] & 0x01) != 0; }
+    uint8_t numSV() const { return payload[23]; }
+    int32_t lon() const { return i4(24); }           // 1e-7 degré
+    int32_t lat() const { return i4(28); }           // 1e-7 degré
+    uint32_t hAcc() const { return u4(40); }         // mm
+    int32_t gSpeed() const { return i4(60); }        // mm/s
+    int32_t headMot() const { return i4(64); }       // 1e-5 degré
+};
+
+// Décodeur UBX incrémental : synchronisation, longueur, somme de contrôle Fletcher-8.
+// Seule la charge utile NAV-PVT est conservée ; les autres trames sont vérifiées puis ignorées.
+class UbxParser {
+private:
+    enum State {
+        SYNC_1,
+        SYNC_2,
+        CLASS,
+        ID,
+        LENGTH_1,
+        LENGTH_2,
+        PAYLOAD,
+        CHECKSUM_A,
+        CHECKSUM_B
+    };
+    
+    State state;
+    uint8_t msgClass;
+    uint8_t msgId;
+    uint16_t length;
+    uint16_t index;
+    uint8_t ckA, ckB;
+    uint8_t payload[UBX_NAV_PVT_LENGTH];
+    
+    uint32_t frameCount;
+    uint32_t checksumErrors;
+    
+    void checksum(uint8_t c) { ckA += c; ckB += ckA; }
+    bool keepPayload() const;
+    
+public:
+    UbxParser();
+    
+    // Ajoute un octet ; retourne true quand une trame NAV-PVT valide est disponible
+    bool encode(uint8_t c);
+    UbxNavPvtView navPvt() const { return UbxNavPvtView(payload); }
+    
+    uint32_t getFrameCount() const { return frameCount; }
+    uint32_t getChecksumErrors() const { return checksumErrors; }
+    
+    // Construit une trame complète (en-tête + somme de contrôle), retourne sa longueur ou 0
+    static size_t buildFrame(uint8_t msgClass, uint8_t msgId, const uint8_t* data, uint16_t dataLength,
+                             uint8_t* out, size_t outSize);
+};
+
+#endif
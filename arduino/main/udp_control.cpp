@@ -0,0 +1,138 @@
+#include "udp_control.h"
+#include "robot_controller.h"
+#include "logger.h"
+
+UdpControl::UdpControl(RobotController* robotController)
+    : robot(robotController), peerPort(0), lastSequence(0), sessionActive(false),
+      packetsAccepted(0), packetsStale(0), packetsMalformed(0) {
+}
+
+void UdpControl::init() {
+    udp.begin(UDP_CONTROL_PORT);
+    Serial.print("✅ Canal UDP de pilotage sur le port ");
+    Serial.println(UDP_CONTROL_PORT);
+}
+
+void UdpControl::registerTasks(TaskScheduler& scheduler) {
+    scheduler.addTask("udp", TASK_PERIOD_UDP, controlTask, this);
+}
+
+void UdpControl::controlTask(void* context) {
+    static_cast<UdpControl*>(context)->update();
+}
+
+void UdpControl::update() {
+    uint8_t packet[UDP_PACKET_SIZE];
+    
+    for (uint8_t i = 0; i < UDP_PACKETS_PER_TICK; i++) {
+        int size = udp.parsePacket();
+        if (size <= 0) return;
+        
+        // Taille inattendue : le reste du datagramme est ignoré au prochain parsePacket()
+        if (size != UDP_PACKET_SIZE) {
+            packetsMalformed++;
+            continue;
+        }
+        
+        udp.read(packet, UDP_PACKET_SIZE);
+        handlePacket(packet);
+    }
+}
+
+void UdpControl::handlePacket(const uint8_t* packet) {
+    if (packet[0] != 'M' || packet[1] != 'C' || packet[2] != UDP_PROTOCOL_VERSION) {
+        packetsMalformed++;
+        return;
+    }
+    
+    uint8_t flags = packet[3];
+    uint32_t sequence = readUint32(packet + 4);
+    uint32_t timestamp = readUint32(packet + 8);
+    uint32_t id = readUint32(packet + 12);
+    
+    IPAddress senderIP = udp.remoteIP();
+    uint16_t senderPort = udp.remotePort();
+    
+    // Nouvel expéditeur ou session explicitement réinitialisée : on repart de cette séquence
+    bool newSession = !sessionActive || (flags & UDP_FLAG_NEW_SESSION) ||
+                      senderPort != peerPort || !(senderIP == peerIP);
+    
+    // Paquet en retard ou dupliqué : ignoré (comparaison tolérante au débordement)
+    if (!newSession && (int32_t)(sequence - lastSequence) <= 0) {
+        packetsStale++;
+        return;
+    }
+    
+    peerIP = senderIP;
+    peerPort = senderPort;
+    lastSequence = sequence;
+    sessionActive = true;
+    packetsAccepted++;
+    
+    // Même chemin que HTTP : sécurités de RobotController incluses
+    CommandResult result = robot->executeCommand(id, "", CMD_SOURCE_WIFI);
+    
+    uint8_t ackFlags = 0;
+    if (result == CMD_BLOCKED) ackFlags |= UDP_ACK_BLOCKED;
+    if (result == CMD_UNKNOWN || result == CMD_INVALID || result == CMD_RESEND) ackFlags |= UDP_ACK_UNKNOWN;
+    if (robot->isObstacleDetected()) ackFlags |= UDP_ACK_OBSTACLE;
+    if (robot->isNavigating()) ackFlags |= UDP_ACK_NAVIGATING;
+    // Mouvement latéral différé : l'issue du scan arrive dans les acquittements suivants
+    if (robot->getLateralStatus() == LATERAL_SCANNING) ackFlags |= UDP_ACK_LATERAL_PENDING;
+    if (robot->getLateralStatus() == LATERAL_BLOCKED) ackFlags |= UDP_ACK_LATERAL_BLOCKED;
+    
+    sendAck(sequence, timestamp, ackFlags);
+    
+    if (result == CMD_BLOCKED) {
+        logText<LOG_WIFI, LOG_LEVEL_INFO>("Commande UDP bloquée");
+    }
+}
+
+void UdpControl::sendAck(uint32_t sequence, uint32_t timestamp, uint8_t flags) {
+    uint8_t ack[UDP_PACKET_SIZE];
+    
+    float distance = robot->getDistance();
+    uint16_t distanceMm = distance >= INVALID_DISTANCE ? 0xFFFF : (uint16_t)(distance * 10);
+    
+    ack[0] = 'M';
+    ack[1] = 'A';
+    ack[2] = UDP_PROTOCOL_VERSION;
+    ack[3] = flags;
+    writeUint32(ack + 4, sequence);
+    writeUint32(ack + 8, timestamp);
+    writeUint16(ack + 12, distanceMm);
+    writeUint16(ack + 14, 0);
+    
+    udp.beginPacket(peerIP, peerPort);
+    udp.write(ack, UDP_PACKET_SIZE);
+    udp.endPacket();
+}
+
+uint32_t UdpControl::readUint32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+           ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+void UdpControl::writeUint32(uint8_t* data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+void UdpControl::writeUint16(uint8_t* data, uint16_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+}
+
+unsigned long UdpControl::getAcceptedCount() const {
+    return packetsAccepted;
+}
+
+unsigned long UdpControl::getStaleCount() const {
+    return packetsStale;
+}
+
+unsigned long UdpControl::getMalformedCount() const {
+    return packetsMalformed;
+}
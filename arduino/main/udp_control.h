@@ -0,0 +1,73 @@
+#ifndef UDP_CONTROL_H
+#define UDP_CONTROL_H
+
+#include <Arduino.h>
+#include <WiFiS3.h>
+#include "config.h"
+#include "task_scheduler.h"
+
+class RobotController; // Forward declaration
+
+// Datagramme de commande (16 octets, petit-boutiste)
+//   0  'M' 'C'     magic
+//   2  version
+//   3  flags       bit0 : nouvelle session (réinitialise la séquence)
+//   4  uint32      numéro de séquence
+//   8  uint32      horodatage client (ms), renvoyé tel quel
+//  12  uint32      identifiant de commande (commandId("forward"), ...)
+//
+// Acquittement (16 octets)
+//   0  'M' 'A'     magic
+//   2  version
+//   3  flags       bit0 bloqué, bit1 obstacle, bit2 navigation, bit3 commande inconnue,
+//                  bit4 scan latéral en cours, bit5 dernier mouvement latéral bloqué
+//   4  uint32      séquence acquittée
+//   8  uint32      horodatage client renvoyé
+//  12  uint16      distance frontale (mm)
+//  14  uint16      réservé
+const uint8_t UDP_PROTOCOL_VERSION = 1;
+const uint8_t UDP_PACKET_SIZE = 16;
+
+const uint8_t UDP_FLAG_NEW_SESSION = 0x01;
+const uint8_t UDP_ACK_BLOCKED = 0x01;
+const uint8_t UDP_ACK_OBSTACLE = 0x02;
+const uint8_t UDP_ACK_NAVIGATING = 0x04;
+const uint8_t UDP_ACK_UNKNOWN = 0x08;
+const uint8_t UDP_ACK_LATERAL_PENDING = 0x10;
+const uint8_t UDP_ACK_LATERAL_BLOCKED = 0x20;
+
+class UdpControl {
+private:
+    WiFiUDP udp;
+    RobotController* robot;
+    
+    // Session courante : expéditeur et dernière séquence acceptée
+    IPAddress peerIP;
+    uint16_t peerPort;
+    uint32_t lastSequence;
+    bool sessionActive;
+    
+    unsigned long packetsAccepted;
+    unsigned long packetsStale;
+    unsigned long packetsMalformed;
+    
+    void handlePacket(const uint8_t* packet);
+    void sendAck(uint32_t sequence, uint32_t timestamp, uint8_t flags);
+    static void controlTask(void* context);
+    
+    static uint32_t readUint32(const uint8_t* data);
+    static void writeUint32(uint8_t* data, uint32_t value);
+    static void writeUint16(uint8_t* data, uint16_t value);
+    
+public:
+    UdpControl(RobotController* robotController);
+    void init();
+    void registerTasks(TaskScheduler& scheduler);
+    void update();
+    
+    unsigned long getAcceptedCount() const;
+    unsigned long getStaleCount() const;
+    unsigned long getMalformedCount() const;
+};
+
+#endif
@@ -1,8 +1,11 @@
 #include "wifi_handler.h"
 #include "robot_controller.h"
+#include "logger.h"
 
 WiFiHandler::WiFiHandler(RobotController* robotController) 
-    : server(WIFI_PORT), lastClientTime(0), robot(robotController) {
+    : server(WIFI_PORT), robot(robotController),
+      http(server, requestReady, streamEventDue, this),
+      response(responseBuffer, sizeof(responseBuffer)) {
 }
 
 void WiFiHandler::init() {
@@ -15,84 +18,238 @@ void WiFiHandler::init() {
     Serial.println("✅ Serveur WiFi démarré");
 }
 
+void WiFiHandler::registerTasks(TaskScheduler& scheduler) {
+    scheduler.addTask("wifi", TASK_PERIOD_WIFI, clientTask, this);
+}
+
+void WiFiHandler::clientTask(void* context) {
+    WiFiHandler* handler = static_cast<WiFiHandler*>(context);
+    ProfileScope scope(handler->robot->getProfiler(), PROFILE_WIFI);
+    handler->handleClients();
+}
+
 void WiFiHandler::handleClients() {
-    WiFiClient client = server.available();
-    if (!client) return;
-    
-    lastClientTime = millis();
+    http.poll();
+}
+
+void WiFiHandler::requestReady(void* context, WiFiConnection& connection) {
+    WiFiHandler* handler = static_cast<WiFiHandler*>(context);
+    handler->processCommand(connection.requestLine, connection);
+    handler->robot->getProfiler().record(PROFILE_HTTP_REQUEST, micros() - connection.requestStartUs);
+}
+
+void WiFiHandler::streamEventDue(void* context, WiFiConnection& connection) {
+    static_cast<WiFiHandler*>(context)->sendStreamEvent(connection);
+}
+
+void WiFiHandler::processCommand(const char* request, WiFiConnection& connection) {
+    if (strstr(request, "GET /metrics") != NULL) {
+        sendMetrics(connection);
+        return;
+    }
+    if (strstr(request, "GET /status") != NULL) {
+        sendStatus(connection);
+        return;
+    }
+    if (strstr(request, "GET /stream") != NULL) {
+        startStream(connection, request);
+        return;
+    }
     
-    String request = "";
-    while (client.connected() && (millis() - lastClientTime < CLIENT_TIMEOUT)) {
-        if (client.available()) {
-            request += client.readStringUntil('\n');
-            break;
-        }
+    const char* dirPos = strstr(request, "dir=");
+    if (dirPos == NULL) {
+        quickResponse(connection, "INVALID");
+        return;
     }
     
-    processCommand(request, client);
-    client.stop();
-}
-
-void WiFiHandler::processCommand(String request, WiFiClient& client) {
-    int dirPos = request.indexOf("dir=");
-    if (dirPos == -1) {
-        quickResponse(client, "INVALID");
+    // Valeur du paramètre jusqu'à l'espace ou au paramètre suivant
+    const char* cmd = dirPos + 4;
+    size_t cmdLength = strcspn(cmd, " &\r\n");
+    if (cmdLength >= COMMAND_MAX_LENGTH) {
+        quickResponse(connection, "INVALID");
         return;
     }
+    uint32_t id = CommandRegistry::hash(cmd, cmdLength);
     
-    String cmd = request.substring(dirPos + 4);
-    int endPos = cmd.indexOf(' ');
-    if (endPos != -1) cmd = cmd.substring(0, endPos);
+    if (id == commandId("status")) {
+        sendStatus(connection);
+        return;
+    }
     
-    if (cmd == "status") {
-        client.println("HTTP/1.1 200 OK\nContent-Type: application/json\nAccess-Control-Allow-Origin: *\nConnection: close\n");
-        client.print("{\"distance\":");
-        client.print(robot->getDistance());
-        client.print(",\"obstacle\":");
-        client.print(robot->isObstacleDetected() ? "true" : "false");
-        client.print(",\"gps_valid\":");
-        client.print(robot->isGPSValid() ? "true" : "false");
-        if (robot->isGPSValid()) {
-            client.print(",\"latitude\":");
-            client.print(robot->getGPSLatitude(), 6);
-            client.print(",\"longitude\":");
-            client.print(robot->getGPSLongitude(), 6);
+    // Arguments éventuels (envoi de mission) : paramètre arg=, sans espace
+    char args[COMMAND_MAX_LENGTH] = "";
+    const char* argPos = strstr(cmd, "arg=");
+    if (argPos != NULL) {
+        size_t argLength = strcspn(argPos + 4, " &\r\n");
+        if (argLength >= sizeof(args)) {
+            quickResponse(connection, "INVALID");
+            return;
         }
-        client.print(",\"gyro_ok\":");
-        client.print(robot->isGyroOK() ? "true" : "false");
-        if (robot->isGyroOK()) {
-            client.print(",\"angle\":");
-            client.print(robot->getRobotAngle(), 1);
-        }
-        client.print(",\"navigating\":");
-        client.print(robot->isNavigating() ? "true" : "false");
-        client.println("}");
-        return;
+        memcpy(args, argPos + 4, argLength);
+        args[argLength] = '\0';
     }
     
-    // Traitement des commandes par le robot
-    bool blocked = false;
+    // Traitement des commandes par le registre du robot (sécurités incluses)
+    CommandResult result = robot->executeCommand(id, args, CMD_SOURCE_WIFI);
+    
+    logFormat<LOG_WIFI, LOG_LEVEL_INFO>("Commande WiFi: %.*s | Bloquée: %s", (int)cmdLength, cmd,
+                                        result == CMD_BLOCKED ? "OUI" : "NON");
     
-    // Bloquer les mouvements manuels si navigation GPS active
-    if (robot->isNavigating() && (cmd == "forward" || cmd == "backward" || cmd == "left" || cmd == "right" || 
-                                 cmd == "forward_left" || cmd == "forward_right" || cmd == "backward_left" || cmd == "backward_right")) {
-        Serial.println("❌ MOUVEMENT BLOQUÉ - Navigation GPS active");
-        blocked = true;
+    if (result == CMD_UNKNOWN || result == CMD_INVALID) {
+        quickResponse(connection, "INVALID");
+    } else if (id == commandId("mission_begin") || id == commandId("mission_chunk")) {
+        // Envoi de mission : la réponse donne la position de reprise (protocole dans le README)
+        const MissionStore& store = robot->getNavigationController().getMissionStore();
+        response.clear();
+        response.print(result == CMD_RESEND ? "RESEND " : "OK ");
+        response.print(store.getReceived());
+        response.print("/");
+        response.println(store.getLength());
+        sendResponse(connection, NULL);
     } else {
-        blocked = robot->processMovementCommand(cmd);
+        quickResponse(connection, result == CMD_BLOCKED ? "BLOCKED" : result == CMD_PENDING ? "PENDING" : "OK");
+    }
+}
+
+void WiFiHandler::sendResponse(WiFiConnection& connection, const char* contentType) {
+    // En-têtes et corps déjà dans le même tampon : une seule écriture vers le module WiFi
+    size_t length;
+    const uint8_t* data = response.finish(contentType, connection.keepAlive, length);
+    connection.client.write(data, length);
+}
+
+void WiFiHandler::quickResponse(WiFiConnection& connection, const char* text) {
+    response.clear();
+    response.println(text);
+    sendResponse(connection, NULL);
+}
+
+void WiFiHandler::writeStatusJson(Print& out) {
+    out.print("{\"distance\":");
+    out.print(robot->getDistance());
+    out.print(",\"obstacle\":");
+    out.print(robot->isObstacleDetected() ? "true" : "false");
+    out.print(",\"gps_valid\":");
+    out.print(robot->isGPSValid() ? "true" : "false");
+    if (robot->isGPSValid()) {
+        out.print(",\"latitude\":");
+        out.print(robot->getGPSLatitude(), 6);
+        out.print(",\"longitude\":");
+        out.print(robot->getGPSLongitude(), 6);
+    }
+    const GPSHandler& gps = robot->getGPSHandler();
+    if (robot->isGPSValid()) {
+        out.print(",\"gps_speed\":");
+        out.print(gps.getGroundSpeed(), 2);
+        out.print(",\"gps_hacc\":");
+        out.print(gps.getHorizontalAccuracy(), 1);
+    }
+    out.print(",\"gps_overflows\":");
+    out.print(gps.getOverflowCount());
+    out.print(",\"gps_bad_sentences\":");
+    out.print(gps.getFailedSentences());
+    out.print(",\"gyro_ok\":");
+    out.print(robot->isGyroOK() ? "true" : "false");
+    if (robot->isGyroOK()) {
+        out.print(",\"angle\":");
+        out.print(robot->getRobotAngle(), 1);
+    }
+    const PoseEstimator& estimator = robot->getPoseEstimator();
+    Pose pose = estimator.getPose();
+    if (estimator.isPositionValid()) {
+        out.print(",\"pose_x\":");
+        out.print(pose.x, 2);
+        out.print(",\"pose_y\":");
+        out.print(pose.y, 2);
+        out.print(",\"pose_sigma\":");
+        out.print(pose.sigmaPosition, 2);
+    }
+    out.print(",\"heading\":");
+    out.print(pose.heading, 1);
+    out.print(",\"speed\":");
+    out.print(pose.speed, 2);
+    LateralStatus lateral = robot->getLateralStatus();
+    if (lateral != LATERAL_IDLE) {
+        out.print(",\"lateral\":");
+        out.print(lateral == LATERAL_SCANNING ? "\"scanning\"" : lateral == LATERAL_DONE ? "\"done\"" : "\"blocked\"");
+    }
+    out.print(",\"navigating\":");
+    out.print(robot->isNavigating() ? "true" : "false");
+    const NavigationController& navigation = robot->getNavigationController();
+    if (navigation.isNavigating()) {
+        out.print(",\"mission_leg\":");
+        out.print(navigation.getCurrentLeg() + 1);
+        out.print(",\"mission_legs\":");
+        out.print(navigation.getMission().size());
+        out.print(",\"mission_progress\":");
+        out.print(navigation.getProgress(), 3);
+        out.print(",\"mission_remaining\":");
+        out.print(navigation.getRemainingDistance(), 1);
+        out.print(",\"mission_eta\":");
+        out.print(navigation.getEta(), 0);
+    }
+    const MissionStore& store = navigation.getMissionStore();
+    if (store.isUploading()) {
+        out.print(",\"mission_received\":");
+        out.print(store.getReceived());
+        out.print(",\"mission_length\":");
+        out.print(store.getLength());
+    }
+    out.print("}");
+}
+
+void WiFiHandler::sendStatus(WiFiConnection& connection) {
+    response.clear();
+    writeStatusJson(response);
+    response.println();
+    sendResponse(connection, "application/json");
+}
+
+// === FLUX SERVER-SENT EVENTS ===
+
+void WiFiHandler::startStream(WiFiConnection& connection, const char* request) {
+    // Cadence demandée : /stream?rate=20 (Hz)
+    unsigned int rate = STREAM_DEFAULT_RATE_HZ;
+    const char* ratePos = strstr(request, "rate=");
+    if (ratePos != NULL) {
+        rate = constrain((unsigned int)atoi(ratePos + 5), 1U, STREAM_MAX_RATE_HZ);
     }
     
-    Serial.print("🎮 Commande WiFi: " + cmd);
-    Serial.print(" | Bloquée: ");
-    Serial.println(blocked ? "OUI" : "NON");
+    connection.client.print("HTTP/1.1 200 OK\r\n"
+                            "Content-Type: text/event-stream\r\n"
+                            "Cache-Control: no-cache\r\n"
+                            "Access-Control-Allow-Origin: *\r\n"
+                            "Connection: keep-alive\r\n"
+                            "\r\n"
+                            "retry: 1000\n\n");
     
-    quickResponse(client, blocked ? "BLOCKED" : "OK");
+    connection.streaming = true;
+    connection.streamInterval = 1000UL / rate;
+    sendStreamEvent(connection);
 }
 
-void WiFiHandler::quickResponse(WiFiClient& client, String response) {
-    client.println("HTTP/1.1 200 OK");
-    client.println("Access-Control-Allow-Origin: *");
-    client.println("Connection: close");
-    client.println();
-    client.println(response);
-}
\ No newline at end of file
+void WiFiHandler::sendStreamEvent(WiFiConnection& connection) {
+    // Événement complet sérialisé dans le tampon de réponse puis envoyé en une écriture
+    // (sans en-têtes HTTP : seul le corps part sur le flux)
+    response.clear();
+    response.print("data: ");
+    writeStatusJson(response);
+    response.print("\n\n");
+    
+    // Un événement tronqué casserait le JSON côté client : on le saute
+    if (response.isOverflow()) {
+        logText<LOG_WIFI, LOG_LEVEL_WARN>("WiFi: événement /stream trop long, ignoré");
+    } else {
+        connection.client.write(response.getBody(), response.getBodyLength());
+    }
+    connection.lastEvent = millis();
+    connection.lastActivity = connection.lastEvent;
+}
+
+void WiFiHandler::sendMetrics(WiFiConnection& connection) {
+    response.clear();
+    size_t available;
+    char* body = response.reserveBody(available);
+    response.commitBody(robot->getProfiler().writeJson(body, available));
+    sendResponse(connection, "application/json");
+}
@@ -4,22 +4,43 @@
 #include <Arduino.h>
 #include <WiFiS3.h>
 #include "config.h"
+#include "task_scheduler.h"
+#include "command_registry.h"
+#include "http_connection_pool.h"
+#include "http_response.h"
 
 class RobotController; // Forward declaration
 
+typedef HttpConnection<WiFiClient> WiFiConnection;
+
 class WiFiHandler {
 private:
     WiFiServer server;
-    unsigned long lastClientTime;
     RobotController* robot;
+    HttpConnectionPool<WiFiServer, WiFiClient> http;
+    
+    // Tampon unique de réponse (une réponse est envoyée avant de traiter la suivante)
+    char responseBuffer[HTTP_RESPONSE_BUFFER_SIZE];
+    HttpResponse response;
+    
+    static void requestReady(void* context, WiFiConnection& connection);
+    static void streamEventDue(void* context, WiFiConnection& connection);
     
-    void quickResponse(WiFiClient& client, String response);
+    void sendResponse(WiFiConnection& connection, const char* contentType);
+    void quickResponse(WiFiConnection& connection, const char* response);
+    void sendStatus(WiFiConnection& connection);
+    void writeStatusJson(Print& out);
+    void startStream(WiFiConnection& connection, const char* request);
+    void sendStreamEvent(WiFiConnection& connection);
+    void sendMetrics(WiFiConnection& connection);
+    static void clientTask(void* context);
     
 public:
     WiFiHandler(RobotController* robotController);
     void init();
+    void registerTasks(TaskScheduler& scheduler);
     void handleClients();
-    void processCommand(String request, WiFiClient& client);
+    void processCommand(const char* request, WiFiConnection& connection);
 };
 
-#endif
\ No newline at end of file
+#endif
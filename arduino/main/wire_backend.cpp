@@ -0,0 +1,27 @@
+#include "wire_backend.h"
+
+void WireBackend::begin() {
+    Wire.begin();
+    Wire.setClock(I2C_CLOCK_HZ);
+}
+
+I2cStatus WireBackend::writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    Wire.write(data, length);
+    uint8_t error = Wire.endTransmission(true);
+    
+    if (error == 0) return I2C_OK;
+    return (error == 2 || error == 3) ? I2C_NACK : I2C_ERROR;
+}
+
+I2cStatus WireBackend::readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    uint8_t error = Wire.endTransmission(false);
+    if (error != 0) return (error == 2 || error == 3) ? I2C_NACK : I2C_ERROR;
+    
+    if (Wire.requestFrom((int)address, (int)length, true) != length) return I2C_ERROR;
+    for (uint8_t i = 0; i < length; i++) data[i] = Wire.read();
+    return I2C_OK;
+}
@@ -0,0 +1,17 @@
+#ifndef WIRE_BACKEND_H
+#define WIRE_BACKEND_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "config.h"
+#include "i2c_bus.h"
+
+// Accès I2C de la carte par la bibliothèque Wire (une transaction à la fois)
+class WireBackend : public I2cBackend {
+public:
+    void begin();
+    virtual I2cStatus writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length);
+    virtual I2cStatus readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef FAKE_HTTP_H
+#define FAKE_HTTP_H
+
+// Faux sockets pour HttpConnectionPool : le banc écrit les requêtes dans FakeSocket,
+// le pool les lit par FakeClient comme il lirait un WiFiClient.
+// Horloge : le test fournit micros() et millis().
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+const size_t FAKE_SOCKET_SIZE = 65536;
+const int FAKE_MAX_REQUESTS = 1024;
+
+struct FakeSocket {
+    char input[FAKE_SOCKET_SIZE];   // Octets envoyés par le client
+    size_t length;
+    size_t pos;                     // Octets déjà lus par le serveur
+    bool open;                      // Fermé côté client
+    bool stopped;                   // Fermé côté serveur (stop())
+    
+    // Horodatage d'envoi et de réponse de chaque requête, par numéro
+    unsigned long sentAt[FAKE_MAX_REQUESTS];
+    int sent;
+    int answered;
+    int outOfOrder;
+    
+    void reset() {
+        length = pos = 0;
+        open = true;
+        stopped = false;
+        sent = answered = outOfOrder = 0;
+    }
+    
+    // Ajoute des octets au flux (requêtes, en-têtes, morceaux)
+    void send(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(input + length, FAKE_SOCKET_SIZE - length, format, args);
+        va_end(args);
+        if (written > 0) length += (size_t)written;
+    }
+    
+    // Requête GET numérotée, éventuellement avec un en-tête trop long pour la ligne
+    void sendRequest(unsigned long now, bool longHeader = false) {
+        sentAt[sent] = now;
+        send("GET /status?n=%d HTTP/1.1\r\nHost: robot\r\n", sent);
+        if (longHeader) {
+            memset(input + length, 'x', 200);
+            length += 200;
+            send("\r\n");
+        }
+        send("\r\n");
+        sent++;
+    }
+    
+    // Réponse du serveur à la requête dont la ligne est donnée ; retourne son numéro
+    int answer(const char* requestLine) {
+        const char* number = strstr(requestLine, "n=");
+        int n = number ? atoi(number + 2) : -1;
+        if (n != answered) outOfOrder++;
+        answered++;
+        return n;
+    }
+};
+
+class FakeClient {
+private:
+    FakeSocket* socket;
+    
+public:
+    FakeClient(FakeSocket* target = NULL) : socket(target) {}
+    
+    operator bool() const { return socket != NULL; }
+    bool connected() const { return socket != NULL && socket->open && !socket->stopped; }
+    int available() const { return socket != NULL ? (int)(socket->length - socket->pos) : 0; }
+    int read() { return available() > 0 ? (uint8_t)socket->input[socket->pos++] : -1; }
+    void stop() { if (socket != NULL) socket->stopped = true; }
+    FakeSocket* getSocket() const { return socket; }
+};
+
+// File des connexions entrantes, prises par accept() dans l'ordre d'arrivée
+class FakeServer {
+private:
+    FakeSocket* pending[8];
+    uint8_t count;
+    
+public:
+    FakeServer() : count(0) {}
+    
+    void connect(FakeSocket& socket) {
+        socket.reset();
+        if (count < 8) pending[count++] = &socket;
+    }
+    
+    FakeClient accept() {
+        if (count == 0) return FakeClient();
+        FakeSocket* socket = pending[0];
+        memmove(pending, pending + 1, --count * sizeof(pending[0]));
+        return FakeClient(socket);
+    }
+};
+
+static int compareUnsigned(const void* a, const void* b) {
+    unsigned long x = *(const unsigned long*)a;
+    unsigned long y = *(const unsigned long*)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+// Centile (0-100) d'une série de durées ; la série est triée sur place
+static unsigned long percentile(unsigned long* values, int count, int rank) {
+    if (count == 0) return 0;
+    qsort(values, count, sizeof(values[0]), compareUnsigned);
+    int index = (count * rank + 99) / 100 - 1;
+    return values[index < 0 ? 0 : index];
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef SIM_ROBOT_H
+#define SIM_ROBOT_H
+
+// Robot différentiel simulé, commun aux bancs de navigation : retard des roues 0,15 s,
+// frottement sous 90 PWM, roue droite 2 % plus faible, voie 0,25 m.
+// Cap en degrés, sens horaire depuis le nord (+y) ; x vers l'est.
+
+#include <math.h>
+#include <stdlib.h>
+#include "config.h"
+
+const float SIM_WHEEL_LAG = 0.15f;      // s
+const int SIM_STICTION_PWM = 90;
+const float SIM_RIGHT_WHEEL_GAIN = 0.98f;
+const float SIM_TRACK = 0.25f;          // m
+
+struct SimRobot {
+    float x, y, heading, rate, left, right;
+    float path;   // Distance parcourue (m)
+};
+
+static inline SimRobot simRobot(float heading = 0.0f) {
+    SimRobot robot = { 0, 0, heading, 0, 0, 0, 0 };
+    return robot;
+}
+
+static inline float simWheelSpeed(int pwm) {
+    return abs(pwm) < SIM_STICTION_PWM ? 0.0f : pwm * MOTOR_PWM_TO_MPS;
+}
+
+static inline float simSpeed(const SimRobot& robot) {
+    return (robot.left + robot.right) / 2;
+}
+
+static inline void simStep(SimRobot& robot, int left, int right, float dt) {
+    robot.left += (simWheelSpeed(left) - robot.left) * dt / SIM_WHEEL_LAG;
+    robot.right += (simWheelSpeed(right) * SIM_RIGHT_WHEEL_GAIN - robot.right) * dt / SIM_WHEEL_LAG;
+    float speed = simSpeed(robot);
+    robot.rate = (robot.left - robot.right) / SIM_TRACK * 180.0f / (float)M_PI;
+    robot.heading += robot.rate * dt;
+    robot.x += speed * sinf(robot.heading * (float)M_PI / 180.0f) * dt;
+    robot.y += speed * cosf(robot.heading * (float)M_PI / 180.0f) * dt;
+    robot.path += fabsf(speed) * dt;
+}
+
+// Écart de cap vers un point, ramené dans [-180, 180[
+static inline float simHeadingError(const SimRobot& robot, float x, float y) {
+    float bearing = atan2f(x - robot.x, y - robot.y) * 180.0f / (float)M_PI;
+    float error = fmodf(bearing - robot.heading, 360.0f);
+    if (error >= 180.0f) error -= 360.0f;
+    else if (error < -180.0f) error += 360.0f;
+    return error;
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+// Strict minimum de l'API Arduino pour compiler les modules testés sur l'hôte.
+// Horloge et broches simulées : le test règle stubMicros et stubPinLevels.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef uint8_t byte;
+
+#define PI 3.14159265358979323846
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+#define digitalPinToInterrupt(pin) (pin)
+#define noInterrupts()
+#define interrupts()
+
+extern unsigned long stubMicros;
+extern int stubPinLevels[32];
+extern void (*stubInterrupts[32])();
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+long pulseIn(int pin, int value, unsigned long timeout);
+void attachInterrupt(int interrupt, void (*isr)(), int mode);
+void detachInterrupt(int interrupt);
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t size) {
+        size_t written = 0;
+        while (size-- && write(*data++)) written++;
+        return written;
+    }
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    
+    size_t print(const char* text) { return write(text); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return printFormat("%d", value); }
+    size_t print(unsigned int value) { return printFormat("%u", value); }
+    size_t print(long value) { return printFormat("%ld", value); }
+    size_t print(unsigned long value) { return printFormat("%lu", value); }
+    size_t print(double value, int digits = 2) { return printFormat("%.*f", digits, value); }
+    
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template <typename T> size_t println(T value, int digits) { size_t n = print(value, digits); return n + println(); }
+    
+private:
+    template <typename... Args> size_t printFormat(const char* format, Args... args) {
+        char text[32];
+        int length = snprintf(text, sizeof(text), format, args...);
+        return write((const uint8_t*)text, length < 0 ? 0 : (size_t)length);
+    }
+};
+
+// Sortie série ignorée
+class StubSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    virtual size_t write(uint8_t) { return 1; }
+    using Print::write;
+};
+
+extern StubSerial Serial;
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef EEPROM_STUB_H
+#define EEPROM_STUB_H
+
+// EEPROM simulée en mémoire (8 Ko comme l'UNO R4) : le test lit ou altère stubEeprom
+// directement, stubEepromWrites compte les octets réellement écrits.
+
+#include "Arduino.h"
+
+const int STUB_EEPROM_SIZE = 8192;
+
+extern uint8_t stubEeprom[STUB_EEPROM_SIZE];
+extern unsigned long stubEepromWrites;
+
+class StubEEPROM {
+public:
+    uint8_t read(int address) const { return stubEeprom[address]; }
+    void write(int address, uint8_t value) {
+        stubEeprom[address] = value;
+        stubEepromWrites++;
+    }
+    void update(int address, uint8_t value) {
+        if (stubEeprom[address] != value) write(address, value);
+    }
+    
+    template <typename T> T& get(int address, T& value) const {
+        memcpy(&value, stubEeprom + address, sizeof(T));
+        return value;
+    }
+    template <typename T> const T& put(int address, const T& value) {
+        const uint8_t* bytes = (const uint8_t*)&value;
+        for (size_t i = 0; i < sizeof(T); i++) update(address + i, bytes[i]);
+        return value;
+    }
+    
+    uint16_t length() const { return STUB_EEPROM_SIZE; }
+};
+
+extern StubEEPROM EEPROM;
+
+#endif
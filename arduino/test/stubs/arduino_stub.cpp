@@ -0,0 +1,21 @@
+#include "Arduino.h"
+#include "EEPROM.h"
+
+unsigned long stubMicros = 0;
+int stubPinLevels[32];
+void (*stubInterrupts[32])();
+StubSerial Serial;
+uint8_t stubEeprom[STUB_EEPROM_SIZE];
+unsigned long stubEepromWrites = 0;
+StubEEPROM EEPROM;
+
+unsigned long millis() { return stubMicros / 1000; }
+unsigned long micros() { return stubMicros; }
+void delay(unsigned long ms) { stubMicros += ms * 1000; }
+void delayMicroseconds(unsigned int us) { stubMicros += us; }
+void pinMode(int, int) {}
+void digitalWrite(int pin, int value) { stubPinLevels[pin] = value; }
+int digitalRead(int pin) { return stubPinLevels[pin]; }
+long pulseIn(int, int, unsigned long) { return 0; }
+void attachInterrupt(int interrupt, void (*isr)(), int) { stubInterrupts[interrupt] = isr; }
+void detachInterrupt(int interrupt) { stubInterrupts[interrupt] = NULL; }
@@ -0,0 +1,139 @@
+#include "command_registry.h"
+#include "test_common.h"
+#include <string.h>
+#include <chrono>
+
+// Noms enregistrés par le robot (RobotController, NavigationController, WiFi)
+static const char* const NAMES[] = {
+    "add", "backward", "backward_left", "backward_right", "calibrate", "clear", "d",
+    "forward", "forward_left", "forward_right", "go", "gyro_live", "gyro_test", "i",
+    "left", "mission_begin", "mission_chunk", "mission_load", "mission_save", "mpu_debug",
+    "mpu_reset", "perf", "perf_reset", "q", "r", "right", "route", "s", "scan", "set",
+    "speed_test", "status", "stop", "tasks", "test", "turn_test", "x", "z"
+};
+static const int NAME_COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
+
+static int hits[NAME_COUNT];
+static char lastArgs[COMMAND_MAX_LENGTH];
+static CommandSource lastSource;
+
+static CommandResult recordHandler(void* target, const CommandRequest& request) {
+    hits[*(int*)target]++;
+    strncpy(lastArgs, request.args, sizeof(lastArgs) - 1);
+    lastSource = request.source;
+    return CMD_OK;
+}
+
+static int indices[NAME_COUNT];
+
+static void fillRegistry(CommandRegistry& registry) {
+    for (int i = 0; i < NAME_COUNT; i++) {
+        indices[i] = i;
+        uint8_t sources = (i % 2) ? CMD_SOURCE_ANY : (uint8_t)CMD_SOURCE_SERIAL;
+        CHECK(registry.add(CommandRegistry::hash(NAMES[i], strlen(NAMES[i])), recordHandler,
+                           &indices[i], sources));
+    }
+}
+
+static void testLookup() {
+    CommandRegistry registry;
+    fillRegistry(registry);
+    memset(hits, 0, sizeof(hits));
+    
+    // Chaque nom retrouve son propre gestionnaire : pas de collision FNV-1a
+    for (int i = 0; i < NAME_COUNT; i++) {
+        char line[COMMAND_MAX_LENGTH];
+        strcpy(line, NAMES[i]);
+        CHECK(registry.dispatch(line, CMD_SOURCE_SERIAL) == CMD_OK);
+        CHECK(hits[i] == 1);
+    }
+    
+    // Identifiant constexpr identique au hachage du nom à l'exécution
+    CHECK(commandId("forward") == CommandRegistry::hash("forward", 7));
+    CHECK(registry.dispatch(commandId("scan"), NULL, CMD_SOURCE_SERIAL) == CMD_OK);
+    CHECK(lastArgs[0] == '\0');
+    
+    char unknown[] = "fly";
+    CHECK(registry.dispatch(unknown, CMD_SOURCE_SERIAL) == CMD_UNKNOWN);
+    char empty[] = "   \r\n";
+    CHECK(registry.dispatch(empty, CMD_SOURCE_SERIAL) == CMD_INVALID);
+}
+
+static void testParsing() {
+    CommandRegistry registry;
+    fillRegistry(registry);
+    
+    // Nom en minuscules, arguments conservés tels quels sans espaces ni fin de ligne
+    char line[] = "  SET 48°50'18\"N, 2°18'41\"E  \r\n";
+    CHECK(registry.dispatch(line, CMD_SOURCE_SERIAL) == CMD_OK);
+    CHECK(strcmp(lastArgs, "48°50'18\"N, 2°18'41\"E") == 0);
+    CHECK(lastSource == CMD_SOURCE_SERIAL);
+    
+    char tab[] = "Forward\t";
+    CHECK(registry.dispatch(tab, CMD_SOURCE_WIFI) == CMD_OK);
+    CHECK(lastArgs[0] == '\0');
+    CHECK(lastSource == CMD_SOURCE_WIFI);
+}
+
+static void testSourcesAndCapacity() {
+    CommandRegistry registry;
+    fillRegistry(registry);
+    
+    // "add" (indice pair) est réservé au port série
+    CHECK(registry.dispatch(commandId("add"), "", CMD_SOURCE_WIFI) == CMD_UNKNOWN);
+    CHECK(registry.dispatch(commandId("backward"), "", CMD_SOURCE_WIFI) == CMD_OK);
+    
+    // Doublon, gestionnaire nul et table pleine sont refusés
+    CHECK(!registry.add(commandId("stop"), recordHandler, &indices[0]));
+    CHECK(!registry.add(commandId("new"), NULL, NULL));
+    int added = 0;
+    char name[8];
+    for (int i = 0; i < MAX_COMMANDS; i++) {
+        snprintf(name, sizeof(name), "extra%d", i);
+        if (registry.add(CommandRegistry::hash(name, strlen(name)), recordHandler, &indices[0])) added++;
+    }
+    CHECK(added == MAX_COMMANDS - NAME_COUNT);
+}
+
+// Ancienne chaîne de comparaisons, pour mesure
+static int dispatchByStrcmp(const char* name) {
+    for (int i = 0; i < NAME_COUNT; i++) {
+        if (strcmp(name, NAMES[i]) == 0) return i;
+    }
+    return -1;
+}
+
+static void benchmark() {
+    CommandRegistry registry;
+    fillRegistry(registry);
+    const int rounds = 20000;
+    char lines[NAME_COUNT][COMMAND_MAX_LENGTH];
+    volatile int sink = 0;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < NAME_COUNT; i++) sink += dispatchByStrcmp(NAMES[i]);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < NAME_COUNT; i++) {
+            strcpy(lines[i], NAMES[i]);
+            sink += registry.dispatch(lines[i], CMD_SOURCE_SERIAL);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    double calls = (double)rounds * NAME_COUNT;
+    printf("  strcmp : %.1f ns/commande, registre : %.1f ns/commande (hôte, %d noms)\n",
+           std::chrono::duration<double, std::nano>(middle - start).count() / calls,
+           std::chrono::duration<double, std::nano>(end - middle).count() / calls, NAME_COUNT);
+    (void)sink;
+}
+
+int main() {
+    testLookup();
+    testParsing();
+    testSourcesAndCapacity();
+    benchmark();
+    return TEST_REPORT("command_registry");
+}
@@ -0,0 +1,34 @@
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdio.h>
+#include <math.h>
+
+// Vérifications minimales pour les tests hôte : chaque échec est affiché,
+// le code de retour de TEST_REPORT() fait échouer "make test".
+static int testFailures = 0;
+static int testChecks = 0;
+
+#define CHECK(condition) do { \
+    testChecks++; \
+    if (!(condition)) { \
+        testFailures++; \
+        printf("  ÉCHEC %s:%d : %s\n", __FILE__, __LINE__, #condition); \
+    } \
+} while (0)
+
+#define CHECK_NEAR(value, expected, tolerance) do { \
+    testChecks++; \
+    double testValue = (value), testExpected = (expected); \
+    if (fabs(testValue - testExpected) > (tolerance)) { \
+        testFailures++; \
+        printf("  ÉCHEC %s:%d : %s = %g, attendu %g ± %g\n", __FILE__, __LINE__, #value, \
+               testValue, testExpected, (double)(tolerance)); \
+    } \
+} while (0)
+
+#define TEST_REPORT(name) ( \
+    printf("%s : %d vérifications, %d échecs\n", (name), testChecks, testFailures), \
+    testFailures == 0 ? 0 : 1)
+
+#endif
@@ -0,0 +1,108 @@
+#include "distance_sensor.h"
+#include "logger.h"
+#include "test_common.h"
+
+// Journal sans effet : seuls les événements du capteur sont référencés
+Logger::Logger() {}
+void Logger::event(LogModule, LogEvent, int32_t) {}
+Logger logger;
+
+// Front d'écho injecté comme le ferait l'interruption
+static void echoEdge(int level, unsigned long atUs) {
+    stubMicros = atUs;
+    stubPinLevels[ECHO_PIN] = level;
+    stubInterrupts[ECHO_PIN]();
+}
+
+static unsigned long echoForDistance(float cm) {
+    return (unsigned long)(cm * 2.0 / 0.034);
+}
+
+static void testEchoCapture() {
+    stubMicros = 0;
+    DistanceSensor sensor(TRIG_PIN, ECHO_PIN);
+    sensor.init();
+    CHECK(stubInterrupts[ECHO_PIN] != NULL);
+    
+    // Premier déclenchement après MEASURE_INTERVAL, aucune attente dans updateDistance()
+    stubMicros = MEASURE_INTERVAL * 1000;
+    CHECK(!sensor.updateDistance());
+    unsigned long trigger = stubMicros;
+    CHECK(trigger - MEASURE_INTERVAL * 1000 < 20);   // Seule l'impulsion de 10 µs
+    
+    CHECK(!sensor.updateDistance());
+    echoEdge(HIGH, trigger + 450);
+    CHECK(!sensor.updateDistance());
+    echoEdge(LOW, trigger + 450 + echoForDistance(100.0));
+    CHECK(sensor.updateDistance());
+    CHECK_NEAR(sensor.getLastValidDistance(), 100.0, 0.1);
+    CHECK(!sensor.isObstacleDetected());
+    
+    // Cible proche : obstacle
+    stubMicros = 2 * MEASURE_INTERVAL * 1000;
+    sensor.updateDistance();
+    trigger = stubMicros;
+    echoEdge(HIGH, trigger + 400);
+    echoEdge(LOW, trigger + 400 + echoForDistance(20.0));
+    CHECK(sensor.updateDistance());
+    CHECK_NEAR(sensor.getLastValidDistance(), 20.0, 0.1);
+    CHECK(sensor.isObstacleDetected());
+}
+
+static void testTimeoutAndSpuriousEdges() {
+    stubMicros = 0;
+    DistanceSensor sensor(TRIG_PIN, ECHO_PIN);
+    sensor.init();
+    
+    // Fronts hors mesure ignorés
+    echoEdge(LOW, 100);
+    echoEdge(HIGH, 200);
+    
+    stubMicros = MEASURE_INTERVAL * 1000;
+    sensor.updateDistance();
+    unsigned long trigger = stubMicros;
+    echoEdge(HIGH, trigger + 400);
+    echoEdge(LOW, trigger + 400 + echoForDistance(55.0));
+    CHECK(sensor.updateDistance());
+    CHECK_NEAR(sensor.getLastValidDistance(), 55.0, 0.1);
+    
+    // Pas d'écho : mesure close après PULSE_TIMEOUT, dernière distance valide conservée
+    stubMicros = 2 * MEASURE_INTERVAL * 1000;
+    sensor.updateDistance();
+    stubMicros += PULSE_TIMEOUT / 2;
+    CHECK(!sensor.updateDistance());
+    stubMicros += PULSE_TIMEOUT;
+    CHECK(sensor.updateDistance());
+    CHECK_NEAR(sensor.getLastValidDistance(), 55.0, 0.1);
+    
+    // Écho hors portée (> MAX_VALID_DISTANCE) : invalide, ignoré
+    stubMicros = 3 * MEASURE_INTERVAL * 1000;
+    sensor.updateDistance();
+    trigger = stubMicros;
+    echoEdge(HIGH, trigger + 400);
+    echoEdge(LOW, trigger + 400 + echoForDistance(MAX_VALID_DISTANCE + 50.0));
+    CHECK(sensor.updateDistance());
+    CHECK_NEAR(sensor.getLastValidDistance(), 55.0, 0.1);
+}
+
+static void testDirectInjection() {
+    // Banc sans interruption : timings injectés par onEchoEdge()
+    stubMicros = 0;
+    DistanceSensor sensor(TRIG_PIN, ECHO_PIN);
+    sensor.init();
+    sensor.startMeasurement();
+    unsigned long trigger = stubMicros;
+    sensor.onEchoEdge(true, trigger + 300);
+    sensor.onEchoEdge(false, trigger + 300 + echoForDistance(250.0));
+    float distance = 0;
+    CHECK(sensor.pollMeasurement(distance));
+    CHECK_NEAR(distance, 250.0, 0.2);
+    CHECK(!sensor.pollMeasurement(distance));
+}
+
+int main() {
+    testEchoCapture();
+    testTimeoutAndSpuriousEdges();
+    testDirectInjection();
+    return TEST_REPORT("distance_sensor");
+}
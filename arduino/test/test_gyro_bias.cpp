@@ -0,0 +1,122 @@
+#include "gyro_bias.h"
+#include "config.h"
+#include "test_common.h"
+#include <random>
+
+// Rejeu synthétique d'une mise en température : T de 20 à 40 °C (constante de temps 3 min),
+// biais vrai 0,8 °/s + 0,03 °/s/°C × (T - 25), bruit 0,06 °/s à 200 Hz,
+// robot immobile 6 s toutes les 20 s. La dérive de cap est l'intégrale de l'erreur de biais.
+
+static const float SAMPLE_RATE = 200.0f;
+static const float TRUE_OFFSET = 0.8f;
+static const float TRUE_SLOPE = 0.03f;
+
+static float trueBias(float temperature) {
+    return TRUE_OFFSET + TRUE_SLOPE * (temperature - MPU_BIAS_REFERENCE_TEMP);
+}
+
+static void testWarmUpReplay() {
+    std::mt19937 generator(2);
+    std::normal_distribution<float> noise(0.0f, 0.06f);
+    GyroBiasEstimator estimator;
+    double drift = 0, bootDrift = 0;
+    double lastMinuteDrift = 0, lastMinuteBootDrift = 0;
+    float bootBias = 0;
+    
+    const long samples = (long)SAMPLE_RATE * 1200;
+    for (long s = 0; s < samples; s++) {
+        float t = s / SAMPLE_RATE;
+        float temperature = 40.0f - 20.0f * expf(-t / 180.0f);
+        bool stationary = fmodf(t, 20.0f) < 6.0f;
+        float truth = trueBias(temperature);
+        estimator.addSample(truth + noise(generator), temperature, stationary);
+        
+        // Référence : calibration unique au démarrage, sans modèle de température
+        if (s == 0) bootBias = truth;
+        
+        drift += (truth - estimator.getBias(temperature)) / SAMPLE_RATE;
+        bootDrift += (truth - bootBias) / SAMPLE_RATE;
+        if (s == samples - (long)SAMPLE_RATE * 60) {
+            lastMinuteDrift = drift;
+            lastMinuteBootDrift = bootDrift;
+        }
+    }
+    
+    CHECK(estimator.isValid());
+    CHECK_NEAR(estimator.getSlope(), TRUE_SLOPE, 0.003);
+    CHECK_NEAR(estimator.getOffset(), TRUE_OFFSET, 0.03);
+    // Dérive de cap sur la dernière minute
+    double minuteDrift = fabs(drift - lastMinuteDrift);
+    double minuteBootDrift = fabs(bootDrift - lastMinuteBootDrift);
+    CHECK(minuteDrift < 0.3);
+    CHECK(minuteBootDrift > 20.0);
+    printf("  pente %.4f °/s/°C, offset %.3f °/s ; dérive dernière minute %.2f° "
+           "(calibration au démarrage : %.1f°)\n",
+           estimator.getSlope(), estimator.getOffset(), minuteDrift, minuteBootDrift);
+}
+
+static void feedWindow(GyroBiasEstimator& estimator, float rate, float temperature, float amplitude) {
+    for (uint16_t i = 0; i < MPU_ZUPT_WINDOW; i++) {
+        // Alternance ± amplitude : écart-type égal à l'amplitude
+        estimator.addSample(rate + ((i & 1) ? amplitude : -amplitude), temperature, true);
+    }
+}
+
+static void testWindowRejection() {
+    GyroBiasEstimator estimator;
+    estimator.setBias(1.0f, 25.0f);
+    uint32_t updates = estimator.getUpdateCount();
+    
+    // Robot poussé : bruit au-delà de MPU_ZUPT_MAX_STDDEV
+    feedWindow(estimator, 1.0f, 25.0f, MPU_ZUPT_MAX_STDDEV * 2);
+    CHECK(estimator.getUpdateCount() == updates);
+    
+    // Rotation lente régulière : écart au biais trop grand
+    feedWindow(estimator, 1.0f + MPU_ZUPT_MAX_STEP * 1.5f, 25.0f, 0.0f);
+    CHECK(estimator.getUpdateCount() == updates);
+    CHECK_NEAR(estimator.getBias(25.0f), 1.0f, 1e-6);
+    
+    // Mouvement au milieu d'une fenêtre : elle repart de zéro
+    for (uint16_t i = 0; i < MPU_ZUPT_WINDOW - 1; i++) estimator.addSample(1.1f, 25.0f, true);
+    estimator.addSample(1.1f, 25.0f, false);
+    estimator.addSample(1.1f, 25.0f, true);
+    CHECK(estimator.getUpdateCount() == updates);
+    
+    feedWindow(estimator, 1.1f, 25.0f, 0.05f);
+    CHECK(estimator.getUpdateCount() == updates + 1);
+}
+
+static void testForgettingAndSlopeHold() {
+    GyroBiasEstimator estimator;
+    estimator.setModel(0.5f, 0.02f);
+    CHECK(estimator.isValid());
+    CHECK_NEAR(estimator.getBias(35.0f), 0.7f, 1e-6);
+    
+    // Température constante : pente conservée, offset suit le nouveau biais (saut de 0,4 °/s)
+    // avec l'oubli MPU_BIAS_FORGETTING (constante ~1 / (1 - oubli) fenêtres)
+    int windows = 0;
+    while (fabsf(estimator.getBias(30.0f) - 1.0f) > 0.01f && windows < 2000) {
+        feedWindow(estimator, 1.0f, 30.0f, 0.02f);
+        windows++;
+    }
+    CHECK_NEAR(estimator.getSlope(), 0.02f, 1e-6);
+    CHECK(windows <= 2);   // Premier point après setModel : le modèle y saute directement
+    
+    // Nouveau saut : convergence progressive selon l'oubli
+    for (int i = 0; i < 20; i++) feedWindow(estimator, 1.0f, 30.0f, 0.02f);
+    int forgetting = 0;
+    while (fabsf(estimator.getBias(30.0f) - 1.3f) > 0.3f * 0.37f && forgetting < 2000) {
+        feedWindow(estimator, 1.3f, 30.0f, 0.02f);
+        forgetting++;
+    }
+    // Constante de temps attendue : entre 20 et 100 fenêtres (mémoire initiale de 21 points)
+    CHECK(forgetting > 10 && forgetting < 100);
+    printf("  saut de 0,3 °/s : 63 %% absorbé en %d fenêtres immobiles\n", forgetting);
+}
+
+int main() {
+    testWarmUpReplay();
+    testWindowRejection();
+    testForgettingAndSlopeHold();
+    return TEST_REPORT("gyro_bias");
+}
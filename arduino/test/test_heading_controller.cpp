@@ -0,0 +1,222 @@
+#include "heading_controller.h"
+#include "config.h"
+#include "test_common.h"
+#include "sim_robot.h"
+
+static void testSlewLimit() {
+    HeadingController controller;
+    const float dt = 0.01f;
+    float previous = 0.0f;
+    bool limited = true;
+    
+    // Saut de consigne de 90° : le différentiel monte de HEADING_SLEW_RATE × dt au plus par pas
+    for (int i = 0; i < 50; i++) {
+        float output = controller.update(90.0f, 0.0f, dt);
+        if (fabsf(output - previous) > HEADING_SLEW_RATE * dt + 1e-3f) limited = false;
+        previous = output;
+    }
+    CHECK(limited);
+    CHECK_NEAR(controller.getOutput(), HEADING_MAX_DIFF, 1e-3);
+    
+    // Retour brutal à zéro : descente tout aussi progressive
+    float output = controller.update(0.0f, 0.0f, dt);
+    CHECK_NEAR(output, HEADING_MAX_DIFF - HEADING_SLEW_RATE * dt, 1e-3);
+    
+    // dt nul : sortie inchangée
+    CHECK(controller.update(-90.0f, 0.0f, 0.0f) == output);
+}
+
+static void testIntegralZoneAndLimit() {
+    HeadingController controller;
+    const float dt = 0.02f;
+    
+    // Erreur persistante de 5° (roue plus faible) : l'intégrale plafonne à HEADING_INTEGRAL_LIMIT
+    for (int i = 0; i < 5000; i++) controller.update(5.0f, 0.0f, dt);
+    CHECK_NEAR(HEADING_KI * controller.getIntegral(), HEADING_INTEGRAL_LIMIT, 1e-3);
+    CHECK_NEAR(controller.getOutput(), HEADING_KP * 5.0f + HEADING_INTEGRAL_LIMIT, 1e-2);
+    
+    // Grande erreur (nouvelle cible) : intégrale vidée
+    controller.update(HEADING_INTEGRAL_ZONE + 1.0f, 0.0f, dt);
+    CHECK(controller.getIntegral() == 0.0f);
+    
+    controller.reset();
+    CHECK(controller.getIntegral() == 0.0f && controller.getOutput() == 0.0f);
+}
+
+static void testAntiWindup() {
+    HeadingController controller;
+    const float dt = 0.01f;
+    
+    // Erreur de 10° mais rotation rapide dans le mauvais sens (poussé) : le terme dérivé
+    // amène la commande à saturation ; l'intégrale s'arrête de croître du même côté
+    const float rate = -600.0f;
+    float unsaturated = HEADING_KP * 10.0f - HEADING_KD * rate;
+    float headroom = (HEADING_MAX_DIFF - unsaturated) / HEADING_KI;   // °·s avant saturation
+    for (int i = 0; i < 2000; i++) controller.update(10.0f, rate, dt);
+    CHECK(controller.getIntegral() <= headroom + 10.0f * dt);
+    CHECK(controller.getIntegral() > headroom - 10.0f * dt);
+    CHECK_NEAR(controller.getOutput(), HEADING_MAX_DIFF, HEADING_KI * 10.0f * dt);
+    
+    // Erreur de signe opposé pendant la saturation : l'intégrale se vide (désaturation)
+    float before = controller.getIntegral();
+    controller.update(-10.0f, rate, dt);
+    CHECK(controller.getIntegral() < before);
+    
+    // Même situation en sens inverse
+    HeadingController mirrored;
+    for (int i = 0; i < 2000; i++) mirrored.update(-10.0f, -rate, dt);
+    CHECK_NEAR(mirrored.getIntegral(), -controller.getIntegral() - 10.0f * dt, 10.0f * dt);
+}
+
+static void testDerivativeDamping() {
+    HeadingController controller;
+    // Cap atteint mais rotation à droite : le différentiel freine la rotation (vers la gauche)
+    for (int i = 0; i < 20; i++) controller.update(0.0f, 100.0f, 0.01f);
+    CHECK_NEAR(controller.getOutput(), -HEADING_KD * 100.0f, 1e-3);
+}
+
+static void testMix() {
+    int left, right;
+    
+    // En ligne droite, sans saturation
+    HeadingController::mix(150.0f, 40.0f, 0.0f, left, right);
+    CHECK(left == 190 && right == 110);
+    
+    // Roue gauche saturée : les deux roues décalées, différentiel de 200 conservé
+    HeadingController::mix(200.0f, 100.0f, 0.0f, left, right);
+    CHECK(left == MOTOR_MAX_PWM && right == MOTOR_MAX_PWM - 200);
+    
+    // Marche arrière saturée côté négatif
+    HeadingController::mix(-200.0f, 100.0f, 0.0f, left, right);
+    CHECK(right == -MOTOR_MAX_PWM && left == -MOTOR_MAX_PWM + 200);
+    
+    // L'avance diminue avec l'erreur de cap (cos 60° = 0,5)
+    HeadingController::mix(200.0f, 0.0f, 60.0f, left, right);
+    CHECK(left == 100 && right == 100);
+    
+    // Au-delà de 90° : rotation sur place
+    HeadingController::mix(200.0f, 120.0f, -120.0f, left, right);
+    CHECK(left == 120 && right == -120);
+    
+    // Différentiel impossible (> 2 × MOTOR_MAX_PWM) : borné sans dépasser la plage
+    HeadingController::mix(0.0f, 300.0f, 180.0f, left, right);
+    CHECK(left == MOTOR_MAX_PWM && right == -MOTOR_MAX_PWM);
+}
+
+static void testClosedLoopStep() {
+    // Changement de cap de 60° en roulant : convergence sans dépassement notable,
+    // erreur statique de la roue faible compensée par l'intégrale
+    HeadingController controller;
+    SimRobot robot = simRobot();
+    const float dt = 0.01f;
+    float overshoot = 0.0f, settledAt = -1.0f;
+    for (int i = 0; i < 2000; i++) {
+        float error = 60.0f - robot.heading;
+        float turn = controller.update(error, robot.rate, dt);
+        int left, right;
+        HeadingController::mix(MOTOR_SPEED_NORMAL, turn, error, left, right);
+        simStep(robot, left, right, dt);
+        overshoot = fmaxf(overshoot, robot.heading - 60.0f);
+        if (fabsf(error) > 2.0f) settledAt = -1.0f;
+        else if (settledAt < 0.0f) settledAt = i * dt;
+    }
+    CHECK(overshoot < 10.0f);
+    CHECK(settledAt >= 0.0f && settledAt < 5.0f);
+    CHECK(fabsf(60.0f - robot.heading) < 1.0f);
+    printf("  cap +60° en roulant : dépassement %.1f°, stabilisé à ±2° en %.2f s\n", overshoot, settledAt);
+}
+
+// Politique remplacée par le régulateur : au-delà de 6° d'écart, rotation sur place
+// jusqu'au cap visé à ±3° (vitesse selon l'écart restant), pause de 150 ms, puis
+// avance tout droit
+struct TurnStopDrive {
+    bool turning;
+    float target;       // Cap visé au début de la rotation
+    float settleUntil;
+    int stops;          // Arrêts pour corriger le cap
+    
+    static int turnSpeed(float error) {
+        float a = fabsf(error);
+        if (a <= 8.0f) return 100;
+        if (a <= 20.0f) return 100 + (int)((a - 8.0f) * 25.0f / 12.0f);
+        if (a <= 45.0f) return 125 + (int)((a - 20.0f) * 25.0f / 25.0f);
+        return 180;
+    }
+    
+    void command(float t, const SimRobot& robot, float error, int& left, int& right) {
+        left = right = 0;
+        if (turning) {
+            float remaining = fmodf(target - robot.heading + 540.0f, 360.0f) - 180.0f;
+            if (fabsf(remaining) <= 3.0f) {
+                turning = false;
+                settleUntil = t + 0.15f;
+                return;
+            }
+            int speed = turnSpeed(remaining);
+            left = remaining > 0 ? speed : -speed;
+            right = -left;
+        } else if (t >= settleUntil) {
+            if (fabsf(error) > 6.0f) {
+                turning = true;
+                stops++;
+                target = robot.heading + error;
+                command(t, robot, error, left, right);
+            } else {
+                left = right = MOTOR_SPEED_NORMAL;
+            }
+        }
+    }
+};
+
+// Carré de 30 m, points validés à 3 m ; retourne la durée, path = distance parcourue
+static float driveSquare(bool pid, float& path, int& stops) {
+    const float corners[][2] = { { 0, 30 }, { 30, 30 }, { 30, 0 }, { 0, 0 } };
+    const float dt = 0.01f;
+    SimRobot robot = simRobot();
+    HeadingController controller;
+    TurnStopDrive baseline = { false, 0, 0, 0 };
+    int corner = 0;
+    float t = 0;
+    while (corner < 4 && t < 600) {
+        if (hypotf(corners[corner][0] - robot.x, corners[corner][1] - robot.y) <= 3.0f) {
+            corner++;
+            continue;
+        }
+        float error = simHeadingError(robot, corners[corner][0], corners[corner][1]);
+        int left, right;
+        if (pid) {
+            HeadingController::mix(MOTOR_SPEED_NORMAL, controller.update(error, robot.rate, dt), error, left, right);
+        } else {
+            baseline.command(t, robot, error, left, right);
+        }
+        simStep(robot, left, right, dt);
+        t += dt;
+    }
+    CHECK(corner == 4);
+    path = robot.path;
+    stops = baseline.stops;
+    return t;
+}
+
+static void testAgainstTurnStopDrive() {
+    // Même robot, même trajet : le régulateur ne s'arrête pas pour corriger le cap
+    float oldPath, pidPath;
+    int oldStops, pidStops;
+    float oldTime = driveSquare(false, oldPath, oldStops);
+    float pidTime = driveSquare(true, pidPath, pidStops);
+    CHECK(pidTime < oldTime);
+    CHECK(pidPath < oldPath * 1.05f);
+    printf("  carré de 30 m : tourner-arrêter-avancer %.1f s / %.1f m (%d arrêts), "
+           "régulateur %.1f s / %.1f m\n", oldTime, oldPath, oldStops, pidTime, pidPath);
+}
+
+int main() {
+    testSlewLimit();
+    testIntegralZoneAndLimit();
+    testAntiWindup();
+    testDerivativeDamping();
+    testMix();
+    testClosedLoopStep();
+    testAgainstTurnStopDrive();
+    return TEST_REPORT("heading_controller");
+}
@@ -0,0 +1,162 @@
+#include "http_connection_pool.h"
+#include "fake_http.h"
+#include "test_common.h"
+
+// Horloge simulée : un passage du pool par période de la tâche WiFi
+static unsigned long fakeTime = 0;
+unsigned long micros() { return fakeTime; }
+unsigned long millis() { return fakeTime / 1000; }
+
+typedef HttpConnectionPool<FakeServer, FakeClient> Pool;
+
+static const int PIPELINE_CLIENTS = MAX_HTTP_CONNECTIONS;
+static const int PIPELINE_REQUESTS = 500;
+static const int PIPELINE_DEPTH = 8;
+
+static FakeSocket sockets[MAX_HTTP_CONNECTIONS + 1];
+static unsigned long rtts[PIPELINE_CLIENTS * PIPELINE_REQUESTS];
+static int rttCount;
+static int requestLimit;   // Requêtes envoyées au plus par client (0 : pas de relance)
+
+// Réponse : RTT relevé, puis le client relance une requête pour garder son pipeline plein
+static void answerRequest(void*, Pool::Connection& connection) {
+    FakeSocket* socket = connection.client.getSocket();
+    int n = socket->answer(connection.requestLine);
+    if (n >= 0 && n < socket->sent) rtts[rttCount++] = fakeTime - socket->sentAt[n];
+    if (socket->sent < requestLimit) socket->sendRequest(fakeTime, socket->sent % 10 == 3);
+}
+
+static void noStream(void*, Pool::Connection&) {}
+
+static void runPasses(Pool& pool, int passes) {
+    while (passes-- > 0) {
+        fakeTime += TASK_PERIOD_WIFI;
+        pool.poll();
+    }
+}
+
+static void testPipelinedKeepAlive() {
+    // Clients persistants, PIPELINE_DEPTH requêtes en vol chacun ; un en-tête sur dix
+    // dépasse le tampon de ligne et doit être ignoré sans casser la requête
+    fakeTime = 0;
+    rttCount = 0;
+    requestLimit = PIPELINE_REQUESTS;
+    FakeServer server;
+    Pool pool(server, answerRequest, noStream, NULL);
+    
+    for (int c = 0; c < PIPELINE_CLIENTS; c++) {
+        server.connect(sockets[c]);
+        for (int n = 0; n < PIPELINE_DEPTH; n++) sockets[c].sendRequest(fakeTime, n % 10 == 3);
+    }
+    
+    unsigned long start = fakeTime;
+    int total = PIPELINE_CLIENTS * PIPELINE_REQUESTS;
+    for (int pass = 0; rttCount < total && pass < 100000; pass++) runPasses(pool, 1);
+    unsigned long elapsed = fakeTime - start;
+    
+    CHECK(rttCount == total);
+    for (int c = 0; c < PIPELINE_CLIENTS; c++) {
+        CHECK(sockets[c].answered == PIPELINE_REQUESTS);
+        CHECK(sockets[c].outOfOrder == 0);
+        CHECK(!sockets[c].stopped);
+    }
+    for (uint8_t slot = 0; slot < MAX_HTTP_CONNECTIONS; slot++) {
+        const Pool::Connection& connection = pool.getConnection(slot);
+        CHECK(connection.active);
+        CHECK(connection.line.getOverflowCount() == (unsigned long)(PIPELINE_REQUESTS / 10));
+        CHECK(!connection.line.isPartial());
+    }
+    
+    // Une requête par client et par passage : RTT borné par la profondeur du pipeline
+    unsigned long p50 = percentile(rtts, rttCount, 50);
+    unsigned long p99 = percentile(rtts, rttCount, 99);
+    CHECK(p99 <= (unsigned long)(PIPELINE_DEPTH + 1) * TASK_PERIOD_WIFI);
+    printf("  pipeline %d x %d : RTT p50 %.1f ms, p99 %.1f ms, %.0f requêtes/s\n",
+           PIPELINE_CLIENTS, PIPELINE_DEPTH, p50 / 1000.0, p99 / 1000.0, total * 1e6 / elapsed);
+}
+
+static void testConnectionClose() {
+    fakeTime = 0;
+    requestLimit = 0;
+    FakeServer server;
+    Pool pool(server, answerRequest, noStream, NULL);
+    
+    // HTTP/1.0 : fermée après la réponse par défaut, gardée avec Connection: keep-alive
+    server.connect(sockets[0]);
+    sockets[0].send("GET /status?n=0 HTTP/1.0\r\n\r\n");
+    server.connect(sockets[1]);
+    sockets[1].send("GET /status?n=0 HTTP/1.0\r\nConnection: keep-alive\r\n\r\n");
+    // HTTP/1.1 : gardée par défaut, fermée avec Connection: close
+    server.connect(sockets[2]);
+    sockets[2].send("GET /status?n=0 HTTP/1.1\r\nconnection: Close\r\n\r\n");
+    server.connect(sockets[3]);
+    sockets[3].send("GET /status?n=0 HTTP/1.1\r\n\r\n\r\nGET /status?n=1 HTTP/1.1\r\n\r\n");
+    runPasses(pool, 3);
+    
+    CHECK(sockets[0].answered == 1 && sockets[0].stopped);
+    CHECK(sockets[1].answered == 1 && !sockets[1].stopped);
+    CHECK(sockets[2].answered == 1 && sockets[2].stopped);
+    CHECK(sockets[3].answered == 2 && !sockets[3].stopped);   // Ligne vide superflue ignorée
+    CHECK(sockets[3].outOfOrder == 0);
+    CHECK(pool.getActiveCount() == 2);
+}
+
+static void testTimeouts() {
+    fakeTime = 0;
+    requestLimit = 0;
+    FakeServer server;
+    Pool pool(server, answerRequest, noStream, NULL);
+    
+    // Requête commencée puis abandonnée, connexion inactive, client parti
+    server.connect(sockets[0]);
+    sockets[0].send("GET /status?n=0 HTTP/1.1\r\nHost: ro");
+    server.connect(sockets[1]);
+    server.connect(sockets[2]);
+    runPasses(pool, 1);
+    CHECK(pool.getActiveCount() == 3);
+    
+    sockets[2].open = false;
+    runPasses(pool, 1);
+    CHECK(sockets[2].stopped);
+    
+    runPasses(pool, HTTP_REQUEST_TIMEOUT * 1000 / TASK_PERIOD_WIFI + 1);
+    CHECK(sockets[0].stopped && sockets[0].answered == 0);
+    CHECK(!sockets[1].stopped);
+    
+    runPasses(pool, HTTP_KEEPALIVE_TIMEOUT * 1000 / TASK_PERIOD_WIFI);
+    CHECK(sockets[1].stopped);
+    CHECK(pool.getActiveCount() == 0);
+}
+
+static void testEviction() {
+    // Tous les emplacements pris : la connexion la plus longtemps inactive cède sa place
+    fakeTime = 0;
+    requestLimit = 0;
+    FakeServer server;
+    Pool pool(server, answerRequest, noStream, NULL);
+    
+    for (int c = 0; c < MAX_HTTP_CONNECTIONS; c++) {
+        server.connect(sockets[c]);
+        runPasses(pool, 10);
+    }
+    // Le premier client reste actif, le deuxième devient le plus ancien
+    sockets[0].sendRequest(fakeTime);
+    runPasses(pool, 1);
+    
+    server.connect(sockets[MAX_HTTP_CONNECTIONS]);
+    sockets[MAX_HTTP_CONNECTIONS].sendRequest(fakeTime);
+    runPasses(pool, 1);
+    
+    CHECK(!sockets[0].stopped);
+    CHECK(sockets[1].stopped);
+    CHECK(sockets[MAX_HTTP_CONNECTIONS].answered == 1);
+    CHECK(pool.getActiveCount() == MAX_HTTP_CONNECTIONS);
+}
+
+int main() {
+    testPipelinedKeepAlive();
+    testConnectionClose();
+    testTimeouts();
+    testEviction();
+    return TEST_REPORT("http_connection_pool");
+}
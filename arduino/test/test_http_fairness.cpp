@@ -0,0 +1,88 @@
+#include "http_connection_pool.h"
+#include "fake_http.h"
+#include "test_common.h"
+
+// Service des connexions par HttpConnectionPool (celui de WiFiHandler) sur de faux sockets :
+// un client envoie une rafale de requêtes en pipeline, les autres une requête à la fois
+// avec un temps de réflexion. On relève la latence de chaque client.
+
+static unsigned long fakeTime = 0;
+unsigned long micros() { return fakeTime; }
+unsigned long millis() { return fakeTime / 1000; }
+
+typedef HttpConnectionPool<FakeServer, FakeClient> Pool;
+
+static const int BURST_REQUESTS = 400;
+static const int BURST_DEPTH = 64;                  // Requêtes en vol du client en rafale
+static const unsigned long THINK_TIME = 20000;      // Entre deux requêtes interactives (µs)
+
+static FakeSocket sockets[MAX_HTTP_CONNECTIONS];
+static unsigned long latencies[MAX_HTTP_CONNECTIONS][FAKE_MAX_REQUESTS];
+static int latencyCount[MAX_HTTP_CONNECTIONS];
+static unsigned long nextSendAt[MAX_HTTP_CONNECTIONS];
+
+static void answerRequest(void*, Pool::Connection& connection) {
+    FakeSocket* socket = connection.client.getSocket();
+    int client = socket - sockets;
+    int n = socket->answer(connection.requestLine);
+    if (n >= 0 && n < socket->sent) latencies[client][latencyCount[client]++] = fakeTime - socket->sentAt[n];
+    
+    if (client == 0) {
+        // Rafale : le pipeline reste plein jusqu'à la dernière requête
+        if (socket->sent < BURST_REQUESTS) socket->sendRequest(fakeTime);
+    } else {
+        // Décalage par client : pas de requêtes interactives synchronisées
+        nextSendAt[client] = fakeTime + THINK_TIME + client * 3000;
+    }
+}
+
+static void noStream(void*, Pool::Connection&) {}
+
+static void simulate(int clients) {
+    fakeTime = 0;
+    FakeServer server;
+    Pool pool(server, answerRequest, noStream, NULL);
+    
+    for (int c = 0; c < clients; c++) {
+        server.connect(sockets[c]);
+        latencyCount[c] = 0;
+        nextSendAt[c] = 0;
+    }
+    for (int n = 0; n < BURST_DEPTH; n++) sockets[0].sendRequest(fakeTime);
+    
+    for (int pass = 0; sockets[0].answered < BURST_REQUESTS && pass < 100000; pass++) {
+        for (int c = 1; c < clients; c++) {
+            FakeSocket& socket = sockets[c];
+            if (socket.sent == socket.answered && fakeTime >= nextSendAt[c]) socket.sendRequest(fakeTime);
+        }
+        fakeTime += TASK_PERIOD_WIFI;
+        pool.poll();
+    }
+    
+    CHECK(sockets[0].answered == BURST_REQUESTS);
+    printf("  %d clients :", clients);
+    for (int c = 0; c < clients; c++) {
+        CHECK(sockets[c].outOfOrder == 0);
+        CHECK(latencyCount[c] == sockets[c].answered);
+        unsigned long p50 = percentile(latencies[c], latencyCount[c], 50);
+        unsigned long p99 = percentile(latencies[c], latencyCount[c], 99);
+        printf("%s n°%d%s p50 %.0f ms, p99 %.0f ms", c == 0 ? "" : " |", c, c == 0 ? " (rafale)" : "",
+               p50 / 1000.0, p99 / 1000.0);
+        
+        // Tourniquet : une requête interactive est servie au passage qui suit son envoi,
+        // quelle que soit la file du client en rafale
+        if (c > 0) {
+            CHECK(latencyCount[c] > 10);
+            CHECK(p99 <= TASK_PERIOD_WIFI);
+        }
+    }
+    printf("\n");
+    
+    // Le client en rafale garde une réponse par passage
+    CHECK(percentile(latencies[0], latencyCount[0], 99) <= (unsigned long)(BURST_DEPTH + 1) * TASK_PERIOD_WIFI);
+}
+
+int main() {
+    for (int clients = 2; clients <= MAX_HTTP_CONNECTIONS; clients++) simulate(clients);
+    return TEST_REPORT("http_fairness");
+}
@@ -0,0 +1,126 @@
+#include "http_response.h"
+#include "test_common.h"
+
+// Socket simulé : compte les appels d'écriture (un segment TCP par appel sur le module WiFi)
+class CountingClient : public Print {
+public:
+    size_t calls;
+    size_t bytes;
+    CountingClient() : calls(0), bytes(0) {}
+    virtual size_t write(uint8_t) { calls++; bytes++; return 1; }
+    virtual size_t write(const uint8_t*, size_t size) { calls++; bytes += size; return size; }
+    using Print::write;
+};
+
+// Corps type /status, écrit champ par champ
+static void writeStatus(Print& out) {
+    out.print("{\"state\":\"");
+    out.print("navigating");
+    out.print("\",\"heading\":");
+    out.print(123.4, 1);
+    out.print(",\"distance\":");
+    out.print(87L);
+    out.print(",\"gps_fix\":");
+    out.print(1);
+    out.print(",\"lat\":");
+    out.print(48.8566142, 7);
+    out.print(",\"lon\":");
+    out.print(2.3522219, 7);
+    out.print("}");
+}
+
+static size_t contentLength(const char* response) {
+    const char* field = strstr(response, "Content-Length: ");
+    return field ? (size_t)strtoul(field + 16, NULL, 10) : (size_t)-1;
+}
+
+static void testResponseLayout() {
+    char storage[1024];
+    HttpResponse response(storage, sizeof(storage));
+    writeStatus(response);
+    CHECK(!response.isOverflow());
+    
+    size_t length;
+    const char* data = (const char*)response.finish("application/json", true, length);
+    CHECK(length > response.getBodyLength());
+    
+    // En-têtes collés devant le corps, Content-Length exact
+    char text[1024];
+    memcpy(text, data, length);
+    text[length] = '\0';
+    CHECK(strncmp(text, "HTTP/1.1 200 OK\r\n", 17) == 0);
+    CHECK(strstr(text, "Content-Type: application/json\r\n") != NULL);
+    CHECK(strstr(text, "Connection: keep-alive\r\n") != NULL);
+    const char* body = strstr(text, "\r\n\r\n");
+    CHECK(body != NULL);
+    if (body) {
+        body += 4;
+        CHECK(contentLength(text) == strlen(body));
+        CHECK(strcmp(body, "{\"state\":\"navigating\",\"heading\":123.4,\"distance\":87,\"gps_fix\":1,"
+                           "\"lat\":48.8566142,\"lon\":2.3522219}") == 0);
+    }
+    
+    // Sans type de contenu, fermeture demandée
+    response.clear();
+    response.print("OK");
+    data = (const char*)response.finish(NULL, false, length);
+    memcpy(text, data, length);
+    text[length] = '\0';
+    CHECK(strstr(text, "Content-Type") == NULL);
+    CHECK(strstr(text, "Connection: close\r\n") != NULL);
+    CHECK(contentLength(text) == 2);
+    CHECK(strcmp(text + length - 2, "OK") == 0);
+}
+
+static void testReserveAndOverflow() {
+    char storage[HTTP_HEADER_RESERVE + 32];
+    HttpResponse response(storage, sizeof(storage));
+    
+    // Écriture directe (snprintf) validée par commitBody
+    size_t available;
+    char* body = response.reserveBody(available);
+    CHECK(available == 32);
+    int written = snprintf(body, available, "%s", "metrics");
+    response.commitBody(written);
+    CHECK(response.getBodyLength() == 7);
+    
+    // Dépassement : tronqué et signalé, jamais d'écriture hors tampon
+    response.print("0123456789012345678901234567890123456789");
+    CHECK(response.isOverflow());
+    CHECK(response.getBodyLength() == 32);
+    
+    response.clear();
+    CHECK(!response.isOverflow());
+    CHECK(response.getBodyLength() == 0);
+}
+
+static void benchmark() {
+    // Ancien envoi : chaque print() part directement sur le socket
+    CountingClient direct;
+    direct.print("HTTP/1.1 200 OK\r\n");
+    direct.print("Content-Type: application/json\r\n");
+    direct.print("Access-Control-Allow-Origin: *\r\n");
+    direct.print("Connection: keep-alive\r\n\r\n");
+    writeStatus(direct);
+    
+    // Nouvel envoi : réponse complète en une écriture
+    char storage[1024];
+    HttpResponse response(storage, sizeof(storage));
+    writeStatus(response);
+    size_t length;
+    const uint8_t* data = response.finish("application/json", true, length);
+    CountingClient buffered;
+    buffered.write(data, length);
+    
+    CHECK(buffered.calls == 1);
+    CHECK(direct.calls > 10);
+    printf("  /status : %u écritures directes (%u octets) contre %u écriture (%u octets)\n",
+           (unsigned)direct.calls, (unsigned)direct.bytes, (unsigned)buffered.calls, (unsigned)buffered.bytes);
+}
+
+int main() {
+    testResponseLayout();
+    testReserveAndOverflow();
+    benchmark();
+    return TEST_REPORT("http_response");
+}
@@ -0,0 +1,172 @@
+#include "i2c_bus.h"
+#include "test_common.h"
+#include <string.h>
+
+// Faux bus : un composant à l'adresse 0x68 (banc de registres), NACK ailleurs.
+// Chaque accès est journalisé pour vérifier l'ordre d'exécution.
+class FakeBackend : public I2cBackend {
+public:
+    uint8_t registers[256];
+    uint8_t log[64];   // Registre de chaque accès, dans l'ordre
+    int accesses;
+    
+    FakeBackend() : accesses(0) {
+        for (int i = 0; i < 256; i++) registers[i] = (uint8_t)i;
+    }
+    
+    virtual I2cStatus writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+        if (accesses < 64) log[accesses] = reg;
+        accesses++;
+        if (address != 0x68) return I2C_NACK;
+        for (uint8_t i = 0; i < length; i++) registers[(uint8_t)(reg + i)] = data[i];
+        return I2C_OK;
+    }
+    
+    virtual I2cStatus readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+        if (accesses < 64) log[accesses] = reg;
+        accesses++;
+        if (address != 0x68) return I2C_NACK;
+        for (uint8_t i = 0; i < length; i++) data[i] = registers[(uint8_t)(reg + i)];
+        return I2C_OK;
+    }
+};
+
+static int callbacks;
+static I2cStatus lastStatus;
+
+static void countCallback(void*, const I2cTransaction&, I2cStatus status) {
+    callbacks++;
+    lastStatus = status;
+}
+
+static void testWraparound() {
+    FakeBackend backend;
+    I2cBus bus(backend);
+    uint8_t data[4];
+    callbacks = 0;
+    
+    // 100 passages de 3 transactions : les index font de nombreux tours de l'anneau de 8
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 3; i++) {
+            CHECK(bus.submitRead(0x68, (uint8_t)(round * 3 + i), data, 1, countCallback, NULL));
+        }
+        CHECK(bus.pending() == 3);
+        CHECK(bus.poll(2) == 2);
+        CHECK(bus.pending() == 1);
+        CHECK(bus.poll(8) == 1);
+        CHECK(bus.isIdle());
+    }
+    CHECK(callbacks == 300);
+    CHECK(bus.getCompleted() == 300);
+    
+    // Ordre FIFO conservé à travers les tours
+    bool ordered = true;
+    for (int i = 0; i < 64; i++) ordered = ordered && backend.log[i] == (uint8_t)i;
+    CHECK(ordered);
+}
+
+static void testQueueFull() {
+    FakeBackend backend;
+    I2cBus bus(backend);
+    uint8_t data[2];
+    
+    // Une case reste libre pour distinguer plein et vide : I2C_QUEUE_SIZE - 1 places
+    int accepted = 0;
+    for (int i = 0; i < I2C_QUEUE_SIZE + 3; i++) {
+        if (bus.submitRead(0x68, (uint8_t)i, data, 2, NULL, NULL)) accepted++;
+    }
+    CHECK(accepted == I2C_QUEUE_SIZE - 1);
+    CHECK(bus.pending() == I2C_QUEUE_SIZE - 1);
+    CHECK(bus.getRejected() == 4);
+    
+    // Une place libérée, une soumission acceptée ; les refusées n'ont pas été exécutées
+    CHECK(bus.poll(1) == 1);
+    CHECK(bus.submitRead(0x68, 0x40, data, 2, NULL, NULL));
+    CHECK(!bus.submitRead(0x68, 0x41, data, 2, NULL, NULL));
+    while (bus.poll(4) > 0) {}
+    CHECK(backend.accesses == I2C_QUEUE_SIZE);
+    CHECK(backend.log[I2C_QUEUE_SIZE - 1] == 0x40);
+    CHECK(bus.getRejected() == 5);
+}
+
+// Lecture en deux temps façon FIFO du MPU : le rappel du compteur soumet la lecture des données
+struct FifoReader {
+    I2cBus* bus;
+    uint8_t count[2];
+    uint8_t samples[8];
+    int stage;
+    int resubmitted;
+};
+
+static void onSamples(void* context, const I2cTransaction&, I2cStatus status) {
+    FifoReader* reader = (FifoReader*)context;
+    if (status == I2C_OK) reader->stage = 2;
+}
+
+static void onCount(void* context, const I2cTransaction& transaction, I2cStatus status) {
+    FifoReader* reader = (FifoReader*)context;
+    if (status != I2C_OK) return;
+    reader->stage = 1;
+    // Le descripteur reçu est une copie : la file peut être modifiée pendant le rappel
+    CHECK(transaction.reg == 0x72);
+    if (reader->bus->submitRead(0x68, 0x74, reader->samples, reader->count[1], onSamples, reader)) {
+        reader->resubmitted++;
+    }
+}
+
+static void testResubmitFromCallback() {
+    FakeBackend backend;
+    backend.registers[0x73] = 6;   // 6 octets disponibles
+    I2cBus bus(backend);
+    FifoReader reader = { &bus, { 0, 0 }, { 0 }, 0, 0 };
+    
+    CHECK(bus.submitRead(0x68, 0x72, reader.count, 2, onCount, &reader));
+    // Une transaction par passage : la lecture chaînée attend le passage suivant
+    CHECK(bus.poll(1) == 1);
+    CHECK(reader.stage == 1 && reader.resubmitted == 1);
+    CHECK(bus.pending() == 1);
+    CHECK(bus.poll(1) == 1);
+    CHECK(reader.stage == 2);
+    CHECK(reader.samples[0] == 0x74 && reader.samples[5] == 0x79);
+    CHECK(bus.isIdle());
+    
+    // Budget de 4 : la transaction chaînée est exécutée dans le même poll()
+    reader.stage = 0;
+    CHECK(bus.submitRead(0x68, 0x72, reader.count, 2, onCount, &reader));
+    CHECK(bus.poll(4) == 2);
+    CHECK(reader.stage == 2 && reader.resubmitted == 2);
+    
+    // File presque pleine : le rappel voit le refus sans écraser une entrée
+    CHECK(bus.submitRead(0x68, 0x72, reader.count, 2, onCount, &reader));
+    uint8_t filler[1];
+    for (int i = 0; i < I2C_QUEUE_SIZE - 2; i++) bus.submitRead(0x68, 0x10, filler, 1, NULL, NULL);
+    CHECK(bus.pending() == I2C_QUEUE_SIZE - 1);
+    CHECK(bus.poll(1) == 1);      // Libère une place, reprise aussitôt par le rappel
+    CHECK(reader.resubmitted == 3);
+    CHECK(bus.pending() == I2C_QUEUE_SIZE - 1);
+}
+
+static void testErrorsAndWrites() {
+    FakeBackend backend;
+    I2cBus bus(backend);
+    callbacks = 0;
+    
+    const uint8_t config[2] = { 0x03, 0x18 };
+    CHECK(bus.submitWrite(0x68, 0x1A, config, 2));   // Sans rappel
+    uint8_t data[1];
+    CHECK(bus.submitRead(0x3C, 0x00, data, 1, countCallback, NULL));   // Aucun composant
+    CHECK(bus.poll(8) == 2);
+    CHECK(backend.registers[0x1A] == 0x03 && backend.registers[0x1B] == 0x18);
+    CHECK(bus.getCompleted() == 1);
+    CHECK(bus.getErrors() == 1);
+    CHECK(callbacks == 1 && lastStatus == I2C_NACK);
+    CHECK(bus.poll(8) == 0);
+}
+
+int main() {
+    testWraparound();
+    testQueueFull();
+    testResubmitFromCallback();
+    testErrorsAndWrites();
+    return TEST_REPORT("i2c_bus");
+}
@@ -0,0 +1,97 @@
+#include "imu_sample_timer.h"
+#include "test_common.h"
+
+// Interruptions "données prêtes" simulées : onDataReady() avec des instants choisis
+static const float NOMINAL_DT = 0.005f;   // 200 Hz
+
+static void testFirstSampleAndJitter() {
+    ImuSampleTimer timer;
+    float dt;
+    CHECK(!timer.nextInterval(dt, NOMINAL_DT));
+    
+    // Premier échantillon : aucune référence, période nominale
+    unsigned long t = 123456;
+    timer.onDataReady(t);
+    CHECK(timer.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, NOMINAL_DT, 1e-9);
+    
+    // Horloge du capteur 2 % lente, gigue d'interruption ± 40 µs : dt mesuré, pas nominal
+    const long jitter[4] = { 0, 40, -40, 10 };
+    for (int i = 0; i < 4; i++) {
+        t += 5100;
+        timer.onDataReady(t + jitter[i]);
+    }
+    CHECK(timer.pending() == 4);
+    float total = 0;
+    while (timer.nextInterval(dt, NOMINAL_DT)) total += dt;
+    CHECK_NEAR(total, 4 * 0.0051 + 10e-6, 1e-6);
+    CHECK(timer.pending() == 0);
+}
+
+static void testMissedInterruptClamp() {
+    ImuSampleTimer timer;
+    float dt;
+    unsigned long t = 1000;
+    timer.onDataReady(t);
+    timer.nextInterval(dt, NOMINAL_DT);
+    
+    // Juste sous 1,5 période : conservé
+    t += 7400;
+    timer.onDataReady(t);
+    CHECK(timer.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, 0.0074, 1e-7);
+    
+    // Interruption manquée (2 périodes) : l'échantillon non horodaté a déjà compté une
+    // période, celui-ci reçoit la période nominale
+    t += 10000;
+    timer.onDataReady(t);
+    CHECK(timer.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, NOMINAL_DT, 1e-9);
+    
+    // La référence suit le dernier horodatage : retour immédiat à la mesure
+    t += 4900;
+    timer.onDataReady(t);
+    CHECK(timer.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, 0.0049, 1e-7);
+    
+    // Débordement de micros() entre deux interruptions
+    ImuSampleTimer wrapping;
+    unsigned long nearWrap = (unsigned long)-2000;
+    wrapping.onDataReady(nearWrap);
+    wrapping.nextInterval(dt, NOMINAL_DT);
+    wrapping.onDataReady(nearWrap + 5000);
+    CHECK(wrapping.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, 0.005, 1e-7);
+}
+
+static void testOverflowAndClear() {
+    ImuSampleTimer timer;
+    float dt;
+    // File pleine à QUEUE_SIZE - 1 : les suivants sont comptés perdus
+    for (int i = 0; i < IMU_TIMESTAMP_QUEUE_SIZE + 8; i++) timer.onDataReady(1000 + i * 5000);
+    CHECK(timer.pending() == IMU_TIMESTAMP_QUEUE_SIZE - 1);
+    CHECK(timer.getDropped() == 9);
+    
+    // Remise à zéro (FIFO du capteur vidé) : file vide, référence oubliée
+    timer.nextInterval(dt, NOMINAL_DT);
+    timer.clear();
+    CHECK(timer.pending() == 0);
+    CHECK(!timer.nextInterval(dt, NOMINAL_DT));
+    timer.onDataReady(900000);
+    CHECK(timer.nextInterval(dt, NOMINAL_DT));
+    CHECK_NEAR(dt, NOMINAL_DT, 1e-9);
+    
+    // Indices qui font plusieurs tours de l'anneau
+    for (int i = 0; i < 100; i++) {
+        timer.onDataReady(900000 + (i + 1) * 5000);
+        CHECK(timer.nextInterval(dt, NOMINAL_DT) && fabsf(dt - 0.005f) < 1e-7f);
+    }
+    CHECK(timer.getDropped() == 9);
+}
+
+int main() {
+    testFirstSampleAndJitter();
+    testMissedInterruptClamp();
+    testOverflowAndClear();
+    return TEST_REPORT("imu_sample_timer");
+}
@@ -0,0 +1,50 @@
+#include "line_assembler.h"
+#include "test_common.h"
+#include <string.h>
+
+static void testBasicLines() {
+    LineAssembler<16> line;
+    const char* input = "GET / HTTP/1.1\r\n\r\n";
+    int lines = 0;
+    for (const char* p = input; *p; p++) {
+        if (line.feed(*p)) {
+            lines++;
+            if (lines == 1) CHECK(strcmp(line.line(), "GET / HTTP/1.1") == 0);
+            if (lines == 2) CHECK(line.lineLength() == 0);   // Fin des en-têtes
+        }
+    }
+    CHECK(lines == 2);
+    CHECK(!line.isPartial());
+    
+    line.feed('a');
+    CHECK(line.isPartial());
+}
+
+static void testOverflow() {
+    // Ligne trop longue ignorée jusqu'à sa fin, la suivante est intacte
+    LineAssembler<8> line;
+    int lines = 0;
+    const char* input = "abcdefghijkl\nok\n";
+    for (const char* p = input; *p; p++) {
+        if (line.feed(*p)) {
+            lines++;
+            CHECK(strcmp(line.line(), "ok") == 0);
+        }
+    }
+    CHECK(lines == 1);
+    CHECK(line.getOverflowCount() == 1);
+    
+    // Exactement N - 1 caractères : accepté
+    LineAssembler<8> exact;
+    const char* seven = "1234567\n";
+    bool done = false;
+    for (const char* p = seven; *p; p++) done = exact.feed(*p);
+    CHECK(done && strcmp(exact.line(), "1234567") == 0);
+    CHECK(exact.getOverflowCount() == 0);
+}
+
+int main() {
+    testBasicLines();
+    testOverflow();
+    return TEST_REPORT("line_assembler");
+}
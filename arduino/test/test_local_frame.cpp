@@ -0,0 +1,113 @@
+#include "local_frame.h"
+#include "test_common.h"
+#include <stdlib.h>
+#include <chrono>
+
+// Références en double, mêmes formules que GPSHandler::calculateDistance/calculateBearing
+static const double EARTH_RADIUS = 6371000.0;
+static const double DEG = M_PI / 180.0;
+
+static double haversine(double lat1, double lng1, double lat2, double lng2) {
+    double dLat = (lat2 - lat1) * DEG;
+    double dLng = (lng2 - lng1) * DEG;
+    double a = sin(dLat / 2) * sin(dLat / 2) +
+               cos(lat1 * DEG) * cos(lat2 * DEG) * sin(dLng / 2) * sin(dLng / 2);
+    return EARTH_RADIUS * 2 * atan2(sqrt(a), sqrt(1 - a));
+}
+
+static double bearing(double lat1, double lng1, double lat2, double lng2) {
+    double dLng = (lng2 - lng1) * DEG;
+    double y = sin(dLng) * cos(lat2 * DEG);
+    double x = cos(lat1 * DEG) * sin(lat2 * DEG) - sin(lat1 * DEG) * cos(lat2 * DEG) * cos(dLng);
+    double result = atan2(y, x) / DEG;
+    return result < 0 ? result + 360 : result;
+}
+
+static double uniform(double low, double high) {
+    return low + (high - low) * (rand() / (double)RAND_MAX);
+}
+
+static void testFastAtan2() {
+    double worst = 0;
+    for (int i = 0; i < 200000; i++) {
+        float y = (float)uniform(-10, 10);
+        float x = (float)uniform(-10, 10);
+        double error = fabs(LocalFrame::fastAtan2(y, x) - atan2((double)y, (double)x));
+        if (error > M_PI) error = 2 * M_PI - error;
+        if (error > worst) worst = error;
+    }
+    // Axes et quadrants exacts
+    CHECK(LocalFrame::fastAtan2(0.0f, 0.0f) == 0.0f);
+    CHECK_NEAR(LocalFrame::fastAtan2(1.0f, 0.0f), M_PI / 2, 1e-6);
+    CHECK_NEAR(LocalFrame::fastAtan2(0.0f, -1.0f), M_PI, 1e-6);
+    CHECK_NEAR(LocalFrame::fastAtan2(-1.0f, -1.0f), -3 * M_PI / 4, 2e-5);
+    CHECK(worst <= 1.2e-5);
+    printf("  fastAtan2 : erreur max %.2e rad\n", worst);
+}
+
+static void testAgainstHaversine() {
+    // Domaine d'emploi : jusqu'à 2 km de la cible, latitudes ≤ 60°
+    double worstRelative = 0, worstBearing = 0;
+    for (int i = 0; i < 200000; i++) {
+        double lat0 = uniform(-60, 60);
+        double lng0 = uniform(-170, 170);
+        double range = uniform(5, 2000);
+        double angle = uniform(0, 2 * M_PI);
+        double lat = lat0 + range * cos(angle) / EARTH_RADIUS / DEG;
+        double lng = lng0 + range * sin(angle) / EARTH_RADIUS / DEG / cos(lat0 * DEG);
+        
+        LocalFrame frame;
+        frame.setOrigin(lat0, lng0);
+        double reference = haversine(lat, lng, lat0, lng0);
+        double relative = fabs(frame.distanceToOrigin(lat, lng) - reference) / reference;
+        double error = fabs(frame.bearingToOrigin(lat, lng) - bearing(lat, lng, lat0, lng0));
+        if (error > 180) error = 360 - error;
+        
+        if (relative > worstRelative) worstRelative = relative;
+        if (error > worstBearing) worstBearing = error;
+    }
+    CHECK(worstRelative < 2e-4);
+    CHECK(worstBearing < 0.02);
+    printf("  5 m - 2 km : distance %.4f %%, cap %.4f° au pire\n", worstRelative * 100, worstBearing);
+}
+
+static void benchmark() {
+    const int count = 1000;
+    static double lats[count], lngs[count];
+    for (int i = 0; i < count; i++) {
+        lats[i] = 48.8566 + uniform(-0.01, 0.01);
+        lngs[i] = 2.3522 + uniform(-0.01, 0.01);
+    }
+    LocalFrame frame;
+    frame.setOrigin(48.8566, 2.3522);
+    volatile double sink = 0;
+    const int rounds = 200;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < count; i++) {
+            sink += haversine(lats[i], lngs[i], 48.8566, 2.3522) + bearing(lats[i], lngs[i], 48.8566, 2.3522);
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < count; i++) {
+            sink += frame.distanceToOrigin(lats[i], lngs[i]) + frame.bearingToOrigin(lats[i], lngs[i]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    double calls = (double)rounds * count;
+    printf("  distance + cap : haversine %.1f ns, plan local %.1f ns (hôte, FPU double)\n",
+           std::chrono::duration<double, std::nano>(middle - start).count() / calls,
+           std::chrono::duration<double, std::nano>(end - middle).count() / calls);
+    (void)sink;
+}
+
+int main() {
+    srand(1);
+    testFastAtan2();
+    testAgainstHaversine();
+    benchmark();
+    return TEST_REPORT("local_frame");
+}
@@ -0,0 +1,63 @@
+#include "loop_profiler.h"
+#include "test_common.h"
+#include <string.h>
+
+// Horloge simulée
+static unsigned long fakeTime = 0;
+unsigned long micros() { return fakeTime; }
+unsigned long millis() { return fakeTime / 1000; }
+
+static void testLongWindowAverage() {
+    // 2 h de boucle à 20 ms : le cumul dépasse largement 2^32 µs
+    LoopProfiler profiler;
+    const uint32_t passes = 2UL * 3600 * 50;
+    for (uint32_t i = 0; i < passes; i++) profiler.record(PROFILE_LOOP, 20000);
+    
+    const ProfileStats& stats = profiler.getStats(PROFILE_LOOP);
+    CHECK(stats.count == passes);
+    CHECK(stats.totalUs > 0xFFFFFFFFULL);
+    CHECK(profiler.getAverage(PROFILE_LOOP) == 20000);
+}
+
+static void testMinMaxPercentile() {
+    fakeTime = 0;
+    LoopProfiler profiler;
+    for (int i = 0; i < 1000; i++) {
+        profiler.record(PROFILE_GYRO, i < 990 ? 100 : 5000);
+        fakeTime += 1000;
+    }
+    
+    const ProfileStats& stats = profiler.getStats(PROFILE_GYRO);
+    CHECK(stats.minUs == 100);
+    CHECK(stats.maxUs == 5000);
+    CHECK(profiler.getAverage(PROFILE_GYRO) == (990 * 100 + 10 * 5000) / 1000);
+    // p50 dans la classe de 100 µs (96..127), p99 encore dedans, p100 au maximum
+    CHECK(profiler.getPercentile(PROFILE_GYRO, 50) == 127);
+    CHECK(profiler.getPercentile(PROFILE_GYRO, 99) == 127);
+    CHECK(profiler.getPercentile(PROFILE_GYRO, 100) == 5000);
+    CHECK(profiler.getFrequency(PROFILE_GYRO) == 1000);
+    CHECK(profiler.getAverage(PROFILE_GPS) == 0);
+    CHECK(profiler.getPercentile(PROFILE_GPS, 99) == 0);
+}
+
+static void testWindowJson() {
+    // Fenêtre mesurée en ms : 100 appels en 2 s
+    fakeTime = 5000000;
+    LoopProfiler profiler;
+    fakeTime += 2000000;
+    for (int i = 0; i < 100; i++) profiler.record(PROFILE_NAVIGATION, 300);
+    CHECK(profiler.getFrequency(PROFILE_NAVIGATION) == 50);
+    
+    char json[640];
+    size_t length = profiler.writeJson(json, sizeof(json));
+    CHECK(length > 0 && length == strlen(json));
+    CHECK(strstr(json, "\"window_ms\":2000,") != NULL);
+    CHECK(strstr(json, "\"navigation\":{\"n\":100,\"hz\":50,") != NULL);
+}
+
+int main() {
+    testLongWindowAverage();
+    testMinMaxPercentile();
+    testWindowJson();
+    return TEST_REPORT("loop_profiler");
+}
@@ -0,0 +1,121 @@
+#include "mission_codec.h"
+#include "test_common.h"
+#include <string.h>
+
+static Waypoint waypoint(int32_t latE6, int32_t lngE6, float speed, float arrivalRadius) {
+    Waypoint point = { latE6, lngE6, speed, arrivalRadius };
+    return point;
+}
+
+static bool sameWaypoint(const Waypoint& a, const Waypoint& b) {
+    return a.latE6 == b.latE6 && a.lngE6 == b.lngE6 &&
+           fabsf(a.speed - b.speed) < 1e-4f && fabsf(a.arrivalRadius - b.arrivalRadius) < 1e-4f;
+}
+
+static void testRoundTrip() {
+    // Tronçons courts, écarts négatifs, saut d'un bout à l'autre du globe (varints de 5 octets)
+    const Waypoint points[] = {
+        waypoint(48856614, 2352222, 0.5f, 2.0f),
+        waypoint(48857514, 2352222, 0.5f, 2.0f),     // 100 m au nord
+        waypoint(48857514, 2350854, 1.2f, 1.5f),     // 100 m à l'ouest
+        waypoint(-89999999, -179999999, 2.55f, 25.5f),
+        waypoint(89999999, 179999999, 0.01f, 0.1f),
+    };
+    const int count = sizeof(points) / sizeof(points[0]);
+    
+    uint8_t stream[count * MISSION_MAX_ENCODED];
+    size_t length = 0;
+    uint8_t legLength[count];
+    MissionEncoder encoder;
+    for (int i = 0; i < count; i++) {
+        legLength[i] = encoder.encode(points[i], stream + length);
+        CHECK(legLength[i] <= MISSION_MAX_ENCODED);
+        length += legLength[i];
+    }
+    CHECK(legLength[1] <= 6 && legLength[2] <= 6);
+    CHECK(legLength[4] == MISSION_MAX_ENCODED);
+    
+    MissionDecoder decoder;
+    Waypoint decoded[count];
+    int decodedCount = 0;
+    for (size_t i = 0; i < length; i++) {
+        Waypoint point;
+        if (decoder.push(stream[i], point) && decodedCount < count) decoded[decodedCount++] = point;
+    }
+    CHECK(!decoder.hasError());
+    CHECK(decoder.isAligned());
+    CHECK(decodedCount == count);
+    for (int i = 0; i < count && i < decodedCount; i++) CHECK(sameWaypoint(decoded[i], points[i]));
+    
+    // Vitesse et rayon bornés à un octet, jamais nuls
+    uint8_t out[MISSION_MAX_ENCODED];
+    encoder.reset();
+    uint8_t n = encoder.encode(waypoint(0, 0, 5.0f, 0.0f), out);
+    CHECK(out[n - 2] == 255 && out[n - 1] == 1);
+    
+    // Flux tronqué : pas d'erreur de varint, mais un point entamé
+    decoder.reset();
+    Waypoint point;
+    for (size_t i = 0; i < (size_t)legLength[0] - 1; i++) CHECK(!decoder.push(stream[i], point));
+    CHECK(!decoder.hasError());
+    CHECK(!decoder.isAligned());
+}
+
+static void testCorruptStream() {
+    // Varint de plus de 5 octets : refusé, et le décodeur reste en erreur
+    MissionDecoder decoder;
+    Waypoint point;
+    const uint8_t overlong[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x32, 0x14 };
+    bool produced = false;
+    for (size_t i = 0; i < sizeof(overlong); i++) produced |= decoder.push(overlong[i], point);
+    CHECK(decoder.hasError());
+    CHECK(!produced);
+    
+    // Latitude hors de [-90, 90]° : point refusé
+    decoder.reset();
+    MissionEncoder encoder;
+    uint8_t stream[MISSION_MAX_ENCODED];
+    uint8_t length = encoder.encode(waypoint(95000000, 0, 0.5f, 2.0f), stream);
+    produced = false;
+    for (uint8_t i = 0; i < length; i++) produced |= decoder.push(stream[i], point);
+    CHECK(decoder.hasError());
+    CHECK(!produced);
+    
+    // Vitesse nulle (octet altéré) : point refusé
+    decoder.reset();
+    encoder.reset();
+    length = encoder.encode(waypoint(48856614, 2352222, 0.5f, 2.0f), stream);
+    stream[length - 2] = 0;
+    produced = false;
+    for (uint8_t i = 0; i < length; i++) produced |= decoder.push(stream[i], point);
+    CHECK(decoder.hasError());
+    CHECK(!produced);
+}
+
+static void testCrc() {
+    // Valeur de contrôle CRC-32 (zlib) et chaînage par morceaux
+    const uint8_t* check = (const uint8_t*)"123456789";
+    CHECK(missionCrc32(0, check, 9) == 0xCBF43926UL);
+    CHECK(missionCrc32(0, check, 0) == 0);
+    
+    uint8_t data[100];
+    for (int i = 0; i < 100; i++) data[i] = (uint8_t)(i * 37 + 11);
+    uint32_t whole = missionCrc32(0, data, sizeof(data));
+    for (size_t split = 0; split <= sizeof(data); split += 7) {
+        CHECK(missionCrc32(missionCrc32(0, data, split), data + split, sizeof(data) - split) == whole);
+    }
+    uint32_t byByte = 0;
+    for (size_t i = 0; i < sizeof(data); i++) byByte = missionCrc32(byByte, data + i, 1);
+    CHECK(byByte == whole);
+    
+    // Un bit changé change le CRC
+    data[42] ^= 0x10;
+    CHECK(missionCrc32(0, data, sizeof(data)) != whole);
+}
+
+int main() {
+    testRoundTrip();
+    testCorruptStream();
+    testCrc();
+    return TEST_REPORT("mission_codec");
+}
@@ -0,0 +1,178 @@
+#include "mission_store.h"
+#include "mission_codec.h"
+#include "EEPROM.h"
+#include "test_common.h"
+
+// Envoi par morceaux dans l'EEPROM simulée (stubs/EEPROM.h), comme mission_begin/mission_chunk
+static const int DATA_ADDR = MISSION_EEPROM_ADDR + sizeof(MissionRecordHeader);
+
+static Mission mission;
+static uint8_t encoded[MISSION_MAX_WAYPOINTS * MISSION_MAX_ENCODED];
+static uint16_t encodedLength;
+static uint32_t encodedCrc;
+
+static void buildMission(uint8_t count) {
+    mission.clear();
+    for (uint8_t i = 0; i < count; i++) {
+        Waypoint waypoint = { 48856614 + i * 900, 2352222 - i * 1368 * (i % 2), 0.5f, 2.0f };
+        mission.add(waypoint);
+    }
+    MissionEncoder encoder;
+    encodedLength = 0;
+    for (uint8_t i = 0; i < count; i++) encodedLength += encoder.encode(mission.get(i), encoded + encodedLength);
+    encodedCrc = missionCrc32(0, encoded, encodedLength);
+}
+
+static uint8_t chunkLength(uint16_t offset) {
+    uint16_t left = encodedLength - offset;
+    return left < MISSION_CHUNK_MAX ? left : MISSION_CHUNK_MAX;
+}
+
+static MissionChunkResult sendChunk(MissionStore& store, uint16_t offset) {
+    uint8_t length = chunkLength(offset);
+    return store.writeChunk(offset, encoded + offset, length, missionCrc32(0, encoded + offset, length));
+}
+
+static bool sameMission(const Mission& a, const Mission& b) {
+    if (a.size() != b.size()) return false;
+    for (uint8_t i = 0; i < a.size(); i++) {
+        if (a.get(i).latE6 != b.get(i).latE6 || a.get(i).lngE6 != b.get(i).lngE6) return false;
+    }
+    return true;
+}
+
+static void eraseEeprom() {
+    memset(stubEeprom, 0xFF, sizeof(stubEeprom));
+}
+
+static void testInOrderUpload() {
+    eraseEeprom();
+    buildMission(20);
+    MissionStore store;
+    store.init();
+    CHECK(!store.isComplete() && !store.isUploading());
+    CHECK(store.begin(mission.size(), encodedLength, encodedCrc));
+    
+    MissionChunkResult result = MISSION_CHUNK_OK;
+    for (uint16_t offset = 0; offset < encodedLength; offset += MISSION_CHUNK_MAX) {
+        result = sendChunk(store, offset);
+        if (offset + MISSION_CHUNK_MAX < encodedLength) CHECK(result == MISSION_CHUNK_OK);
+    }
+    CHECK(result == MISSION_CHUNK_COMPLETE);
+    CHECK(store.isComplete());
+    CHECK(memcmp(stubEeprom + DATA_ADDR, encoded, encodedLength) == 0);
+    
+    // Relue au redémarrage, octet par octet depuis l'EEPROM
+    MissionStore reboot;
+    reboot.init();
+    Mission loaded;
+    CHECK(reboot.isComplete() && reboot.getCount() == 20);
+    CHECK(reboot.load(loaded));
+    CHECK(sameMission(loaded, mission));
+}
+
+static void testOutOfOrderAndResend() {
+    eraseEeprom();
+    buildMission(20);
+    MissionStore store;
+    store.init();
+    store.begin(mission.size(), encodedLength, encodedCrc);
+    
+    // Morceau en avance (le précédent est perdu) : refusé, rien n'est écrit
+    unsigned long writes = stubEepromWrites;
+    CHECK(sendChunk(store, MISSION_CHUNK_MAX) == MISSION_CHUNK_REJECTED);
+    CHECK(store.getReceived() == 0);
+    CHECK(stubEepromWrites == writes);
+    
+    CHECK(sendChunk(store, 0) == MISSION_CHUNK_OK);
+    CHECK(sendChunk(store, MISSION_CHUNK_MAX) == MISSION_CHUNK_OK);
+    CHECK(store.getReceived() == 2 * MISSION_CHUNK_MAX);
+    
+    // Renvoi d'un morceau déjà écrit (accusé perdu) : accepté sans réécrire l'EEPROM
+    writes = stubEepromWrites;
+    CHECK(sendChunk(store, MISSION_CHUNK_MAX) == MISSION_CHUNK_OK);
+    CHECK(sendChunk(store, 0) == MISSION_CHUNK_OK);
+    CHECK(store.getReceived() == 2 * MISSION_CHUNK_MAX);
+    CHECK(stubEepromWrites == writes);
+    
+    // CRC du morceau faux, débordement de la mission, morceau vide : refusés
+    uint16_t offset = store.getReceived();
+    CHECK(store.writeChunk(offset, encoded + offset, 8, missionCrc32(0, encoded + offset, 8) ^ 1) ==
+          MISSION_CHUNK_REJECTED);
+    CHECK(store.writeChunk(encodedLength - 4, encoded, 8, missionCrc32(0, encoded, 8)) == MISSION_CHUNK_REJECTED);
+    CHECK(store.writeChunk(offset, encoded, 0, 0) == MISSION_CHUNK_REJECTED);
+    CHECK(store.getReceived() == offset);
+    
+    // Coupure : le même mission_begin reprend au dernier morceau écrit, une autre mission repart de 0
+    MissionStore reboot;
+    reboot.init();
+    CHECK(reboot.isUploading() && reboot.getReceived() == offset);
+    CHECK(reboot.begin(mission.size(), encodedLength, encodedCrc));
+    CHECK(reboot.getReceived() == offset);
+    for (uint16_t next = offset; next < encodedLength; next += MISSION_CHUNK_MAX) sendChunk(reboot, next);
+    CHECK(reboot.isComplete());
+    CHECK(reboot.begin(mission.size(), encodedLength, encodedCrc ^ 1));
+    CHECK(reboot.getReceived() == 0);
+}
+
+static void testCorruptUpload() {
+    eraseEeprom();
+    buildMission(20);
+    MissionStore store;
+    store.init();
+    store.begin(mission.size(), encodedLength, encodedCrc);
+    
+    // Octet altéré en EEPROM après son écriture : le CRC global du dernier morceau le détecte
+    uint16_t offset = 0;
+    for (; offset + MISSION_CHUNK_MAX < encodedLength; offset += MISSION_CHUNK_MAX) sendChunk(store, offset);
+    stubEeprom[DATA_ADDR + 5] ^= 0x04;
+    CHECK(sendChunk(store, offset) == MISSION_CHUNK_CORRUPT);
+    CHECK(store.getReceived() == 0);
+    CHECK(!store.isComplete());
+    Mission loaded;
+    CHECK(!store.load(loaded));
+    
+    // Renvoi complet : la mission est réécrite
+    for (offset = 0; offset < encodedLength; offset += MISSION_CHUNK_MAX) sendChunk(store, offset);
+    CHECK(store.isComplete());
+    CHECK(store.load(loaded) && sameMission(loaded, mission));
+    
+    // Mission complète altérée ensuite : refusée au chargement, mission courante intacte
+    stubEeprom[DATA_ADDR + 9] ^= 0x80;
+    CHECK(!store.load(loaded));
+    CHECK(sameMission(loaded, mission));
+    
+    // En-tête altéré : ignoré au démarrage
+    stubEeprom[MISSION_EEPROM_ADDR + 4] ^= 0x01;
+    MissionStore reboot;
+    reboot.init();
+    CHECK(!reboot.isComplete() && !reboot.isUploading());
+}
+
+static void testSave() {
+    eraseEeprom();
+    buildMission(MISSION_MAX_WAYPOINTS);
+    MissionStore store;
+    store.init();
+    CHECK(store.save(mission));
+    CHECK(store.getLength() == encodedLength && store.isComplete());
+    
+    // Même mission réenregistrée : update() ne réécrit aucune donnée, seul l'en-tête
+    // passe par l'état incomplet puis revient
+    unsigned long writes = stubEepromWrites;
+    CHECK(store.save(mission));
+    CHECK(stubEepromWrites - writes <= 2 * sizeof(MissionRecordHeader));
+    CHECK(encodedLength > 2 * sizeof(MissionRecordHeader));
+    
+    Mission loaded;
+    CHECK(store.load(loaded) && sameMission(loaded, mission));
+    CHECK(!store.save(Mission()));
+}
+
+int main() {
+    testInOrderUpload();
+    testOutOfOrderAndResend();
+    testCorruptUpload();
+    testSave();
+    return TEST_REPORT("mission_store");
+}
@@ -0,0 +1,154 @@
+#include "pose_estimator.h"
+#include "test_common.h"
+#include <random>
+
+// Rejeu d'un trajet synthétique : 0,5 m/s, virage de 90° à t = 30 s, gyroscope biaisé
+// (0,3 °/s) et bruité, GPS à 10 Hz (σ 2,5 m, route σ 3°). Le filtre démarre avec
+// un cap faux de 60° et doit retrouver cap et position à partir du GPS seul.
+
+static const double EARTH_RADIUS = 6371000.0;
+static const double DEG = M_PI / 180.0;
+static const double ORIGIN_LAT = 48.85;
+static const double ORIGIN_LNG = 2.35;
+
+struct Truth {
+    float x, y, heading, speed;
+};
+
+static void toGeo(float x, float y, double& lat, double& lng) {
+    lat = ORIGIN_LAT + y / EARTH_RADIUS / DEG;
+    lng = ORIGIN_LNG + x / EARTH_RADIUS / DEG / cos(ORIGIN_LAT * DEG);
+}
+
+static float headingError(float estimate, float truth) {
+    float diff = fmodf(estimate - truth + 540.0f, 360.0f) - 180.0f;
+    return fabsf(diff);
+}
+
+static float positionError(const PoseEstimator& estimator, const Truth& truth) {
+    double lat, lng;
+    toGeo(truth.x, truth.y, lat, lng);
+    float x, y;
+    estimator.toLocal(lat, lng, x, y);
+    Pose pose = estimator.getPose();
+    return hypotf(pose.x - x, pose.y - y);
+}
+
+static void testReplay() {
+    std::mt19937 generator(3);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    PoseEstimator estimator;
+    estimator.reset(0.0f);
+    Truth truth = { 0.0f, 0.0f, 60.0f, 0.5f };
+    const float dt = 0.01f;
+    
+    float worstHeading = 0, worstPosition = 0, worstSpeed = 0;
+    int outsideThreeSigma = 0, checked = 0;
+    float sigmaBeforeOutage = 0, sigmaAfterOutage = 0;
+    
+    for (int k = 0; k < 6000; k++) {
+        float rate = (k > 3000 && k <= 3300) ? 30.0f : 0.0f;
+        truth.heading += rate * dt;
+        truth.x += truth.speed * sinf(truth.heading * DEG) * dt;
+        truth.y += truth.speed * cosf(truth.heading * DEG) * dt;
+        
+        estimator.predict(rate + 0.3f + noise(generator) * 0.2f, truth.speed, dt);
+        
+        // Coupure GPS de 5 s (tunnel) entre 45 et 50 s
+        bool outage = k >= 4500 && k < 5000;
+        if (k % 10 == 0 && !outage) {
+            double lat, lng;
+            toGeo(truth.x + noise(generator) * 2.5f, truth.y + noise(generator) * 2.5f, lat, lng);
+            estimator.updateGps(lat, lng, 2.5f, truth.speed + noise(generator) * 0.1f,
+                                truth.heading + noise(generator) * 3.0f, 1);
+        }
+        if (k == 4499) sigmaBeforeOutage = estimator.getPose().sigmaPosition;
+        if (k == 4999) sigmaAfterOutage = estimator.getPose().sigmaPosition;
+        
+        // Régime établi (après 10 s), hors virage
+        if (k >= 1000 && (k < 3000 || k > 3500) && k % 10 == 5) {
+            Pose pose = estimator.getPose();
+            float position = positionError(estimator, truth);
+            worstHeading = fmaxf(worstHeading, headingError(pose.heading, fmodf(truth.heading, 360.0f)));
+            worstPosition = fmaxf(worstPosition, position);
+            worstSpeed = fmaxf(worstSpeed, fabsf(pose.speed - truth.speed));
+            if (position > 3.0f * pose.sigmaPosition) outsideThreeSigma++;
+            checked++;
+        }
+    }
+    
+    CHECK(estimator.isPositionValid());
+    CHECK(estimator.getGpsUpdateCount() == 550);
+    CHECK(worstHeading < 4.0f);
+    CHECK(worstPosition < 1.5f);
+    CHECK(worstSpeed < 0.15f);
+    // Incertitude annoncée cohérente avec l'erreur réelle
+    CHECK(outsideThreeSigma * 20 < checked);
+    // Sans GPS, l'incertitude croît
+    CHECK(sigmaAfterOutage > sigmaBeforeOutage);
+    printf("  régime établi : cap %.1f°, position %.2f m, vitesse %.2f m/s au pire ; "
+           "σ %.2f -> %.2f m pendant la coupure\n",
+           worstHeading, worstPosition, worstSpeed, sigmaBeforeOutage, sigmaAfterOutage);
+}
+
+static void testReversing() {
+    // Marche arrière à 0,4 m/s cap au nord (déplacement vers le sud), consigne sous-estimée
+    // de 20 % : la vitesse GPS non signée doit être prise négative, la route (180°) ignorée
+    std::mt19937 generator(5);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    PoseEstimator estimator;
+    estimator.reset(0.0f);
+    Truth truth = { 0.0f, 0.0f, 0.0f, -0.4f };
+    const float dt = 0.01f;
+    
+    float speedSum = 0;
+    int speedSamples = 0;
+    for (int k = 0; k < 3000; k++) {
+        truth.y += truth.speed * dt;
+        estimator.predict(noise(generator) * 0.2f, truth.speed * 0.8f, dt);
+        
+        if (k % 10 == 0) {
+            double lat, lng;
+            toGeo(truth.x + noise(generator) * 2.5f, truth.y + noise(generator) * 2.5f, lat, lng);
+            estimator.updateGps(lat, lng, 2.5f, fabsf(truth.speed + noise(generator) * 0.1f),
+                                180.0f + noise(generator) * 3.0f, -1);
+        }
+        if (k >= 2000) {
+            speedSum += estimator.getPose().speed;
+            speedSamples++;
+        }
+    }
+    
+    float speed = speedSum / speedSamples;
+    CHECK(speed < -0.33f && speed > -0.45f);
+    CHECK(positionError(estimator, truth) < 1.5f);
+    CHECK(headingError(estimator.getHeading(), 0.0f) < 3.0f);
+    printf("  marche arrière : vitesse %.2f m/s (réelle -0.40, consigne -0.32), position %.2f m\n",
+           speed, positionError(estimator, truth));
+    
+    // Consigne nulle mais GPS en mouvement (robot poussé) : vitesse non corrigée
+    for (int k = 0; k < 500; k++) estimator.predict(0.0f, 0.0f, dt);
+    double lat, lng;
+    toGeo(truth.x, truth.y, lat, lng);
+    for (int k = 0; k < 20; k++) estimator.updateGps(lat, lng, 2.5f, 0.8f, 90.0f, 0);
+    CHECK_NEAR(estimator.getPose().speed, 0.0f, 0.01);
+}
+
+static void testReset() {
+    PoseEstimator estimator;
+    estimator.reset(123.0f);
+    CHECK(!estimator.isPositionValid());
+    CHECK_NEAR(estimator.getHeading(), 123.0f, 1e-4);
+    
+    // Sans GPS, la prédiction intègre le gyroscope et reste dans [0, 360[
+    for (int i = 0; i < 100; i++) estimator.predict(-300.0f, 0.0f, 0.01f);
+    CHECK_NEAR(estimator.getHeading(), 183.0f, 0.01);
+    CHECK(estimator.getGpsUpdateCount() == 0);
+}
+
+int main() {
+    testReplay();
+    testReversing();
+    testReset();
+    return TEST_REPORT("pose_estimator");
+}
@@ -0,0 +1,134 @@
+#include "pure_pursuit.h"
+#include "heading_controller.h"
+#include "config.h"
+#include "sim_robot.h"
+#include "test_common.h"
+#include <stddef.h>
+
+static bool samePoint(const PathPoint& p, float x, float y) {
+    return fabsf(p.x - x) < 1e-3f && fabsf(p.y - y) < 1e-3f;
+}
+
+static void testProgress() {
+    PathPoint a = { 0, 0 }, b = { 0, 10 };
+    PathPoint before = { 2, -5 }, middle = { -3, 5 }, beyond = { 0, 12 };
+    CHECK_NEAR(PurePursuit::progress(a, b, before), -0.5, 1e-6);
+    CHECK_NEAR(PurePursuit::progress(a, b, middle), 0.5, 1e-6);
+    CHECK_NEAR(PurePursuit::progress(a, b, beyond), 1.2, 1e-6);
+    // Tronçon de longueur nulle : considéré comme parcouru
+    CHECK(PurePursuit::progress(a, a, middle) == 1.0f);
+    CHECK_NEAR(PurePursuit::distance(a, PathPoint{ 3, 4 }), 5.0, 1e-6);
+}
+
+static void testLegReached() {
+    PathPoint a = { 0, 0 }, b = { 0, 10 };
+    PathPoint inRadius = { 1, 9.5f }, approaching = { 3, 9 }, passed = { 3, 10.5f };
+    CHECK(PurePursuit::legReached(a, b, inRadius, 2.0f, false));
+    CHECK(PurePursuit::legReached(a, b, inRadius, 2.0f, true));
+    CHECK(!PurePursuit::legReached(a, b, approaching, 2.0f, false));
+    // Point intermédiaire dépassé à côté : on enchaîne ; le dernier doit être atteint
+    CHECK(PurePursuit::legReached(a, b, passed, 2.0f, false));
+    CHECK(!PurePursuit::legReached(a, b, passed, 2.0f, true));
+    
+    // Visée minimale à l'arrêt, puis proportionnelle à la vitesse
+    CHECK_NEAR(PurePursuit::lookahead(0.0f), PURSUIT_MIN_LOOKAHEAD, 1e-6);
+    CHECK_NEAR(PurePursuit::lookahead(2.0f), 2.0f * PURSUIT_LOOKAHEAD_TIME, 1e-6);
+}
+
+static void testGoal() {
+    PathPoint a = { 0, 0 }, b = { 0, 10 }, next = { 10, 10 };
+    
+    // Sur le trajet : visée à la distance de visée, devant le robot
+    PathPoint p = { 0, 2 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &next, p, 3.0f), 0, 5));
+    
+    // Près du virage : la visée passe sur le tronçon suivant avant d'atteindre b
+    p = PathPoint{ 0, 8 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &next, p, 3.0f), sqrtf(5.0f), 10));
+    
+    // Décalé latéralement de 2 m : visée sur le trajet, plus loin que la projection
+    p = PathPoint{ 2, 4 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &next, p, 3.0f), 0, 4 + sqrtf(5.0f)));
+    
+    // Trop loin du trajet pour le croiser : projection sur le tronçon
+    p = PathPoint{ 20, 5 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &next, p, 3.0f), 0, 5));
+    p = PathPoint{ -20, -5 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &next, p, 3.0f), 0, 0));
+    
+    // Dernier point dans le cercle de visée : on le vise directement
+    p = PathPoint{ 0, 8.5f };
+    CHECK(samePoint(PurePursuit::goal(a, b, NULL, p, 3.0f), 0, 10));
+    // Fin du tronçon suivant dans le cercle : on vise son extrémité
+    PathPoint shortNext = { 1, 10 };
+    p = PathPoint{ 0, 9 };
+    CHECK(samePoint(PurePursuit::goal(a, b, &shortNext, p, 3.0f), 1, 10));
+}
+
+static float crossTrack(const PathPoint& a, const PathPoint& b, const PathPoint& p) {
+    float length = PurePursuit::distance(a, b);
+    return fabsf((b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x)) / length;
+}
+
+static void testSquareMission() {
+    // Mission carrée de 30 m avec les règles de NavigationController::navigate() :
+    // PurePursuit::legReached() pour enchaîner, visée et consigne à la vitesse du tronçon
+    const PathPoint waypoints[] = { { 0, 30 }, { 30, 30 }, { 30, 0 }, { 0, 0 } };
+    const int count = 4;
+    const float dt = TASK_PERIOD_NAVIGATION / 1000000.0f;
+    const float lookahead = PurePursuit::lookahead(MISSION_DEFAULT_SPEED);
+    const float forwardPwm = fminf(MISSION_DEFAULT_SPEED / MOTOR_PWM_TO_MPS, (float)MOTOR_MAX_PWM);
+    
+    SimRobot robot = simRobot();
+    HeadingController controller;
+    PathPoint start = { 0, 0 };
+    int leg = 0;
+    float t = 0, minSpeed = 10, worstCrossTrack = 0;
+    float closestCorner[count] = { 100, 100, 100, 100 };
+    
+    while (leg < count && t < 600) {
+        PathPoint position = { robot.x, robot.y };
+        PathPoint a = leg ? waypoints[leg - 1] : start;
+        PathPoint b = waypoints[leg];
+        bool last = leg + 1 >= count;
+        
+        if (PurePursuit::legReached(a, b, position, MISSION_DEFAULT_RADIUS, last)) {
+            leg++;
+            continue;
+        }
+        
+        PathPoint goal = PurePursuit::goal(a, b, last ? NULL : &waypoints[leg + 1], position, lookahead);
+        float error = simHeadingError(robot, goal.x, goal.y);
+        float turn = controller.update(error, robot.rate, dt);
+        int left, right;
+        HeadingController::mix(forwardPwm, turn, error, left, right);
+        simStep(robot, left, right, dt);
+        t += dt;
+        
+        if (t > 2.0f) minSpeed = fminf(minSpeed, simSpeed(robot));
+        float progress = PurePursuit::progress(a, b, position);
+        if (progress > 0.2f && progress < 0.8f) {
+            worstCrossTrack = fmaxf(worstCrossTrack, crossTrack(a, b, position));
+        }
+        for (int i = 0; i < count; i++) {
+            closestCorner[i] = fminf(closestCorner[i], PurePursuit::distance(position, waypoints[i]));
+        }
+    }
+    
+    CHECK(leg == count);
+    // Jamais d'arrêt aux points intermédiaires, virages coupés sans s'écarter du trajet
+    CHECK(minSpeed > 0.3f);
+    CHECK(worstCrossTrack < 1.0f);
+    CHECK(closestCorner[1] > 0.5f && closestCorner[1] < lookahead);
+    CHECK(closestCorner[count - 1] <= MISSION_DEFAULT_RADIUS);
+    printf("  carré de 30 m : %.1f s, %.1f m parcourus, vitesse min %.2f m/s, écart latéral max %.2f m, "
+           "virage coupé à %.1f m du point\n", t, robot.path, minSpeed, worstCrossTrack, closestCorner[1]);
+}
+
+int main() {
+    testProgress();
+    testLegReached();
+    testGoal();
+    testSquareMission();
+    return TEST_REPORT("pure_pursuit");
+}
@@ -0,0 +1,133 @@
+#include "task_scheduler.h"
+#include "test_common.h"
+
+// Horloge simulée : chaque tâche fait avancer le temps de sa durée
+static unsigned long fakeTime = 0;
+unsigned long micros() { return fakeTime; }
+
+static unsigned long taskCost = 0;
+static int calls[3];
+
+static void countedTask(void* context) {
+    calls[*(int*)context]++;
+    fakeTime += taskCost;
+}
+
+static void testPeriodicRate() {
+    fakeTime = 0;
+    taskCost = 100;
+    calls[0] = calls[1] = 0;
+    int ids[2] = { 0, 1 };
+    TaskScheduler scheduler;
+    CHECK(scheduler.addTask("rapide", 10000, countedTask, &ids[0]) == 0);
+    CHECK(scheduler.addTask("boucle", 0, countedTask, &ids[1]) == 1);
+    
+    // 1 s de boucle à pas de 50 µs
+    while (fakeTime < 1000000) {
+        scheduler.run();
+        fakeTime += 50;
+    }
+    CHECK(calls[0] >= 99 && calls[0] <= 101);
+    CHECK(scheduler.getStats(0).lateRuns == 0);
+    CHECK(scheduler.getStats(0).longRuns == 0);
+    CHECK(scheduler.getStats(0).maxJitterUs < 10000);
+    CHECK(calls[1] > calls[0]);
+}
+
+static void testOverrunResync() {
+    // Tâche plus longue que sa période : comptée en dépassement, pas de rafale de rattrapage
+    fakeTime = 0;
+    taskCost = 25000;
+    calls[0] = 0;
+    int id = 0;
+    TaskScheduler scheduler;
+    scheduler.addTask("lente", 10000, countedTask, &id);
+    for (int i = 0; i < 40; i++) {
+        scheduler.run();
+        fakeTime += 1000;
+    }
+    const TaskStats& stats = scheduler.getStats(0);
+    // Chaque exécution est trop longue ; chaque départ suivant est en retard (le premier non)
+    CHECK(stats.longRuns == stats.runs);
+    CHECK(stats.lateRuns == stats.runs - 1);
+    CHECK(stats.maxDurationUs == 25000);
+    CHECK(calls[0] == 40);   // Une seule exécution par passage
+}
+
+static unsigned long spikeAt = 0;
+
+static void spikeTask(void* context) {
+    calls[*(int*)context]++;
+    fakeTime += (fakeTime >= spikeAt && fakeTime < spikeAt + 1000) ? 25000 : 100;
+}
+
+static void testSingleSpikeCountedOnce() {
+    // Une seule exécution de 25 ms sur une période de 10 ms : une exécution trop longue
+    // et un seul départ en retard (recalage), pas de double comptage
+    fakeTime = 0;
+    spikeAt = 500000;
+    calls[0] = calls[1] = 0;
+    int ids[2] = { 0, 1 };
+    TaskScheduler scheduler;
+    scheduler.addTask("pic", 10000, spikeTask, &ids[0]);
+    scheduler.addTask("voisine", 20000, countedTask, &ids[1]);
+    taskCost = 0;
+    while (fakeTime < 1000000) {
+        scheduler.run();
+        fakeTime += 100;
+    }
+    CHECK(scheduler.getStats(0).longRuns == 1);
+    CHECK(scheduler.getStats(0).lateRuns == 1);
+    CHECK(scheduler.getStats(1).longRuns == 0);
+}
+
+static void testClockWrap() {
+    // Débordement de micros() : la comparaison signée garde la cadence
+    fakeTime = 0xFFFFFFFFUL - 25000;
+    taskCost = 0;
+    calls[0] = 0;
+    int id = 0;
+    TaskScheduler scheduler;
+    scheduler.addTask("debordement", 10000, countedTask, &id);
+    for (int i = 0; i < 100; i++) {
+        scheduler.run();
+        fakeTime += 1000;
+    }
+    CHECK(calls[0] >= 9 && calls[0] <= 11);
+}
+
+static void testDisableAndCapacity() {
+    fakeTime = 0;
+    taskCost = 0;
+    calls[0] = 0;
+    int id = 0;
+    TaskScheduler scheduler;
+    int task = scheduler.addTask("pause", 1000, countedTask, &id);
+    scheduler.setEnabled(task, false);
+    for (int i = 0; i < 10; i++) {
+        scheduler.run();
+        fakeTime += 1000;
+    }
+    CHECK(calls[0] == 0);
+    
+    // Réactivation sans rattrapage des échéances manquées
+    scheduler.setEnabled(task, true);
+    scheduler.run();
+    CHECK(calls[0] == 1);
+    scheduler.run();
+    CHECK(calls[0] == 1);
+    
+    for (uint8_t i = 1; i < MAX_SCHEDULED_TASKS; i++) scheduler.addTask("x", 1000, countedTask, &id);
+    CHECK(scheduler.getTaskCount() == MAX_SCHEDULED_TASKS);
+    CHECK(scheduler.addTask("trop", 1000, countedTask, &id) == -1);
+    CHECK(scheduler.addTask("nul", 1000, NULL, &id) == -1);
+}
+
+int main() {
+    testPeriodicRate();
+    testOverrunResync();
+    testSingleSpikeCountedOnce();
+    testClockWrap();
+    testDisableAndCapacity();
+    return TEST_REPORT("task_scheduler");
+}
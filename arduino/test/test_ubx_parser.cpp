@@ -0,0 +1,139 @@
+#include "ubx_parser.h"
+#include "test_common.h"
+#include <string.h>
+
+// Trame NAV-PVT de référence (octets bruts) : 17/10/2026 12:30:05, fix 3D, 11 satellites,
+// 48.8566142 N 2.3522219 E, hAcc 1850 mm, 1,24 m/s, cap 90,5°
+static const uint8_t REFERENCE_NAV_PVT[] = {
+    0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0x00, 0x70, 0x99, 0x14, 0xEA, 0x07,
+    0x0A, 0x11, 0x0C, 0x1E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x0B, 0xAB, 0xEB, 0x66, 0x01, 0x7E, 0xED,
+    0x1E, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x04, 0x00, 0x00, 0x90, 0x17,
+    0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBC, 0xCF,
+};
+
+// Flux enregistré côté robot : NMEA résiduel avant CFG-PRT, acquittements, puis NAV-PVT à 10 Hz
+static uint8_t stream[8192];
+static size_t streamLength;
+
+static void append(const void* data, size_t length) {
+    memcpy(stream + streamLength, data, length);
+    streamLength += length;
+}
+
+static void appendNavPvt(int32_t lat, int32_t lon, uint8_t fixType) {
+    uint8_t payload[UBX_NAV_PVT_LENGTH];
+    memcpy(payload, REFERENCE_NAV_PVT + 6, sizeof(payload));
+    payload[20] = fixType;
+    for (int i = 0; i < 4; i++) {
+        payload[24 + i] = (uint8_t)(lon >> (8 * i));
+        payload[28 + i] = (uint8_t)(lat >> (8 * i));
+    }
+    streamLength += UbxParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, payload, sizeof(payload),
+                                          stream + streamLength, sizeof(stream) - streamLength);
+}
+
+static void testReferenceFrame() {
+    UbxParser parser;
+    int frames = 0;
+    for (size_t i = 0; i < sizeof(REFERENCE_NAV_PVT); i++) {
+        if (parser.encode(REFERENCE_NAV_PVT[i])) frames++;
+    }
+    CHECK(frames == 1);
+    
+    UbxNavPvtView pvt = parser.navPvt();
+    CHECK(pvt.iTOW() == 345600000UL);
+    CHECK(pvt.hour() == 12 && pvt.minute() == 30 && pvt.second() == 5);
+    CHECK(pvt.fixType() == 3 && pvt.gnssFixOK());
+    CHECK(pvt.numSV() == 11);
+    CHECK(pvt.lat() == 488566142);
+    CHECK(pvt.lon() == 23522219);
+    CHECK(pvt.hAcc() == 1850);
+    CHECK(pvt.gSpeed() == 1240);
+    CHECK(pvt.headMot() == 9050000);
+    
+    // buildFrame reproduit la trame à l'octet près
+    uint8_t rebuilt[128];
+    size_t length = UbxParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, REFERENCE_NAV_PVT + 6,
+                                          UBX_NAV_PVT_LENGTH, rebuilt, sizeof(rebuilt));
+    CHECK(length == sizeof(REFERENCE_NAV_PVT));
+    CHECK(memcmp(rebuilt, REFERENCE_NAV_PVT, length) == 0);
+}
+
+static void testStreamReplay() {
+    streamLength = 0;
+    const char* nmea = "$GNGGA,123004.00,4851.39685,N,00221.13331,E,1,11,0.9,35.2,M,46.3,M,,*7B\r\n"
+                       "$GNRMC,123004.00,A,4851.39685,N,00221.13331,E,2.41,90.5,171026,,,A*70\r\n";
+    append(nmea, strlen(nmea));
+    
+    // ACK-ACK de CFG-PRT, CFG-RATE et CFG-MSG (vérifiés puis ignorés)
+    const uint8_t acked[3] = { UBX_CFG_PRT, UBX_CFG_RATE, UBX_CFG_MSG };
+    for (int i = 0; i < 3; i++) {
+        uint8_t ack[2] = { UBX_CLASS_CFG, acked[i] };
+        streamLength += UbxParser::buildFrame(0x05, 0x01, ack, sizeof(ack),
+                                              stream + streamLength, sizeof(stream) - streamLength);
+    }
+    
+    // 40 époques, dont une trame corrompue, un en-tête à longueur aberrante et une trame tronquée
+    int expected = 0;
+    for (int n = 0; n < 40; n++) {
+        size_t start = streamLength;
+        appendNavPvt(488566142 + n * 10, 23522219 + n * 15, 3);
+        if (n == 10) {
+            stream[start + 40] ^= 0x20;
+        } else if (n == 20) {
+            // Octets de longueur corrompus (0xFFFF) juste avant une trame valide
+            const uint8_t bogus[6] = { UBX_SYNC_1, UBX_SYNC_2, UBX_CLASS_NAV, UBX_NAV_PVT, 0xFF, 0xFF };
+            memmove(stream + start + sizeof(bogus), stream + start, streamLength - start);
+            memcpy(stream + start, bogus, sizeof(bogus));
+            streamLength += sizeof(bogus);
+            expected++;
+        } else if (n == 30) {
+            streamLength = start + 50;   // Octets perdus (UART saturé)
+        } else if (n == 31) {
+            // Ses premiers octets complètent la charge utile tronquée : perdue aussi
+        } else {
+            expected++;
+        }
+    }
+    
+    // Relecture octet par octet : positions croissantes, jamais de trame invalide acceptée
+    UbxParser parser;
+    int frames = 0;
+    int32_t lastLat = 0;
+    bool ordered = true;
+    for (size_t i = 0; i < streamLength; i++) {
+        if (!parser.encode(stream[i])) continue;
+        frames++;
+        UbxNavPvtView pvt = parser.navPvt();
+        if (pvt.lat() <= lastLat || (pvt.lat() - 488566142) % 10 != 0) ordered = false;
+        lastLat = pvt.lat();
+    }
+    CHECK(frames == expected);
+    CHECK(ordered);
+    CHECK(parser.getChecksumErrors() == 2);
+    CHECK(parser.getFrameCount() == (uint32_t)expected + 3);
+}
+
+static void testOversizedLength() {
+    // Longueur plus grande que NAV-PVT : abandon immédiat, la trame suivante est lue
+    UbxParser parser;
+    const uint8_t header[6] = { UBX_SYNC_1, UBX_SYNC_2, UBX_CLASS_NAV, UBX_NAV_PVT, UBX_NAV_PVT_LENGTH + 1, 0x00 };
+    for (size_t i = 0; i < sizeof(header); i++) parser.encode(header[i]);
+    int frames = 0;
+    for (size_t i = 0; i < sizeof(REFERENCE_NAV_PVT); i++) {
+        if (parser.encode(REFERENCE_NAV_PVT[i])) frames++;
+    }
+    CHECK(frames == 1);
+}
+
+int main() {
+    testReferenceFrame();
+    testStreamReplay();
+    testOversizedLength();
+    return TEST_REPORT("ubx_parser");
+}